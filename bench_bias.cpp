@@ -0,0 +1,115 @@
+#include "xepl.hpp"
+#include <chrono>
+
+// Reference counting on a Lobe's own Atoms, biased against unbiased on the same Lobe thread
+//   g++ -std=c++17 -O2 -pthread bench_bias.cpp -o bench_bias
+//   ./bench_bias [attach_pairs] [body_genes] [passes]
+
+static long             pairs  = 5000000;
+static long             genes  = 500;
+static long             passes = 200;
+static long             steps  = 0;
+static std::atomic_bool benched { false };
+
+static double Seconds_Since ( std::chrono::steady_clock::time_point _start )
+{
+	return std::chrono::duration<double> ( std::chrono::steady_clock::now() - _start ).count();
+}
+
+class Bench : public XEPL::Lobe
+{
+	double Attach_Pairs ( void )
+	{
+		XEPL::Gene* gene  = new XEPL::Gene ( nullptr, "local", nullptr );
+		auto        start = std::chrono::steady_clock::now();
+
+		for ( long pair = 0; pair < pairs; ++pair )
+		{
+			gene->Attach();
+			gene->Release();
+		}
+
+		double seconds = Seconds_Since ( start );
+		gene->Release();
+		return seconds;
+	}
+
+	double Process_Body ( XEPL::Gene* _body )
+	{
+		auto start = std::chrono::steady_clock::now();
+
+		for ( long pass = 0; pass < passes; ++pass )
+			Process_Inner_Genes ( _body );
+
+		return Seconds_Since ( start );
+	}
+public:
+	Bench ( XEPL::Neuron* _parent, XEPL::Gene* _config ) : Lobe ( _parent, _config ) {}
+	void Lobe_Rest_Now ( void ) override
+	{
+		if ( !benched )
+		{
+			// a method body of Genes with traits, duplicated per statement
+			XEPL::Gene* body = new XEPL::Gene ( nullptr, "body", nullptr );
+			for ( long index = 0; index < genes; ++index )
+			{
+				XEPL::Gene* step = new XEPL::Gene ( body, "Step", nullptr );
+				step->Trait_Set ( "index", std::to_string ( index ).c_str() );
+				step->Trait_Set ( "kind",  "bench" );
+			}
+			body->Escape();
+
+			// alternate rounds, giving up the bias claim for the unbiased half
+			double attach[2] = { 0, 0 };
+			double process[2] = { 0, 0 };
+
+			for ( int round = 0; round < 10; ++round )
+			{
+				attach[0]  += Attach_Pairs();
+				process[0] += Process_Body ( body );
+
+				XEPL::OwnerBias::Vacate_Thread();
+				attach[1]  += Attach_Pairs();
+				process[1] += Process_Body ( body );
+				XEPL::OwnerBias::Claim_Thread();
+			}
+			body->Release();
+
+			std::cout << "                          biased   unbiased\n"
+			          << 10*pairs << " Attach/Release   " << attach[0] << "s  " << attach[1] << "s\n"
+			          << 10*passes << " x " << genes << " Gene body   " << process[0] << "s  " << process[1] << "s  ("
+			          << steps << " steps)\n" << std::flush;
+
+			benched = true;
+		}
+		Lobe::Lobe_Rest_Now();
+	}
+};
+
+int main ( int argc, char** argv )
+{
+	pairs  = argc > 1 ? atol ( argv[1] ) : pairs;
+	genes  = argc > 2 ? atol ( argv[2] ) : genes;
+	passes = argc > 3 ? atol ( argv[3] ) : passes;
+
+	XEPL::Cortex cortex ( "brain", std::cout );
+
+	cortex.Register_Keyword ( "Step", [] ( XEPL::Neuron*, XEPL::Gene*, XEPL::String* )
+	{
+		++steps;
+	} );
+
+	cortex.Register_Keyword ( "Bench", [] ( XEPL::Neuron* _neuron, XEPL::Gene*, XEPL::String* )
+	{
+		XEPL::Gene* config = new XEPL::Gene ( nullptr, "bench", nullptr );
+		( new Bench ( _neuron, config ) )->Start_Lobe();
+		config->Release();
+
+		while ( !benched )
+			std::this_thread::sleep_for ( std::chrono::milliseconds ( 10 ) );
+
+		_neuron->Drop_Neuron ( "bench" );
+	} );
+
+	cortex.Execute_As_Xml ( "<Bench/>" );
+}
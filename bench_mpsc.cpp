@@ -0,0 +1,101 @@
+#include "xepl.hpp"
+#include <chrono>
+
+// N producer Lobes posting into one consumer Lobe's ActionList
+//   g++ -std=c++17 -O2 -pthread bench_mpsc.cpp -o bench_mpsc
+//   ./bench_mpsc [actions_per_producer]
+
+static std::atomic_bool producers_go  { false };
+static std::atomic_long producers_done{ 0 };
+static std::atomic_long actions_done  { 0 };
+static long             per_producer = 200000;
+static XEPL::Lobe*      consumer     = nullptr;
+
+class Counted : public XEPL::Action
+{
+public:
+	Counted ( void ) : Action ( XEPL::Ref<XEPL::Receptor>(), nullptr ) {}
+	void Action_Execute ( void ) override { actions_done.fetch_add ( 1, std::memory_order_relaxed ); }
+};
+
+class Consumer : public XEPL::Lobe
+{
+public:
+	Consumer ( XEPL::Neuron* _parent, XEPL::Gene* _config ) : Lobe ( _parent, _config ) {}
+};
+
+class Producer : public XEPL::Lobe
+{
+	bool benched = false;
+public:
+	Producer ( XEPL::Neuron* _parent, XEPL::Gene* _config ) : Lobe ( _parent, _config ) {}
+	void Lobe_Rest_Now ( void ) override
+	{
+		if ( !benched )
+		{
+			benched = true;
+
+			while ( !producers_go )
+				std::this_thread::yield();
+
+			for ( long index = 0; index < per_producer; ++index )
+				consumer->pending_actions->Post_Action ( new Counted() );
+
+			++producers_done;
+		}
+		Lobe::Lobe_Rest_Now();
+	}
+};
+
+static XEPL::Lobe* Start ( XEPL::Neuron* _parent, const std::string& _name, bool _producer )
+{
+	XEPL::Gene* config = new XEPL::Gene ( nullptr, _name.c_str(), nullptr );
+	XEPL::Lobe* lobe   = _producer ? static_cast<XEPL::Lobe*> ( new Producer ( _parent, config ) )
+	                               : static_cast<XEPL::Lobe*> ( new Consumer ( _parent, config ) );
+	lobe->Start_Lobe();
+	config->Release();
+	return lobe;
+}
+
+int main ( int argc, char** argv )
+{
+	per_producer = argc > 1 ? atol ( argv[1] ) : per_producer;
+
+	XEPL::Cortex cortex ( "brain", std::cout );
+
+	cortex.Register_Keyword ( "Bench", [] ( XEPL::Neuron* _neuron, XEPL::Gene*, XEPL::String* )
+	{
+		consumer = Start ( _neuron, "consumer", false );
+
+		for ( long producers : { 1, 2, 4, 8 } )
+		{
+			double best = 1e9;
+
+			for ( int repeat = 0; repeat < 3; ++repeat )
+			{
+				producers_go   = false;
+				producers_done = 0;
+				actions_done   = 0;
+
+				for ( long producer = 0; producer < producers; ++producer )
+					Start ( _neuron, "producer" + std::to_string ( producer ), true );
+
+				auto start = std::chrono::steady_clock::now();
+				producers_go = true;
+
+				while ( producers_done < producers || actions_done < producers*per_producer )
+					std::this_thread::yield();
+
+				best = std::min ( best, std::chrono::duration<double> ( std::chrono::steady_clock::now() - start ).count() );
+
+				for ( long producer = 0; producer < producers; ++producer )
+					_neuron->Drop_Neuron ( "producer" + std::to_string ( producer ) );
+			}
+			std::cout << producers << " producers: " << producers*per_producer/best/1e6 << " M actions/s\n" << std::flush;
+		}
+
+		_neuron->Drop_Neuron ( "consumer" );
+	} );
+
+	cortex.Execute_As_Xml ( "<Bench/>" );
+}
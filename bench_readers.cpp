@@ -0,0 +1,81 @@
+#include "xepl.hpp"
+#include <chrono>
+
+// Many Lobes reading one shared Gene
+//   g++ -std=c++17 -O2 -pthread bench_readers.cpp -o bench_readers
+//   ./bench_readers [lobes] [rounds]
+
+static XEPL::Gene*      shared_gene = nullptr;
+static std::atomic_bool readers_go  { false };
+static std::atomic_long readers_done{ 0 };
+static long             lobes  = 16;
+static long             rounds = 200000;
+
+class Reader : public XEPL::Lobe
+{
+	bool benched = false;
+public:
+	Reader ( XEPL::Neuron* _parent, XEPL::Gene* _config ) : Lobe ( _parent, _config ) {}
+	void Lobe_Rest_Now ( void ) override
+	{
+		if ( !benched )
+		{
+			benched = true;
+
+			while ( !readers_go )
+				std::this_thread::yield();
+
+			XEPL::String term;
+			XEPL::Gene*  kid = nullptr;
+
+			for ( long round = 0; round < rounds; ++round )
+			{
+				shared_gene->Trait_Get ( "name", &term );
+				shared_gene->Get_First_Gene ( "kid", &kid );
+				shared_gene->Has_Content();
+			}
+			++readers_done;
+		}
+		Lobe::Lobe_Rest_Now();
+	}
+};
+
+int main ( int argc, char** argv )
+{
+	lobes  = argc > 1 ? atol ( argv[1] ) : lobes;
+	rounds = argc > 2 ? atol ( argv[2] ) : rounds;
+
+	XEPL::Cortex cortex ( "brain", std::cout );
+
+	cortex.Register_Keyword ( "Bench", [] ( XEPL::Neuron* _neuron, XEPL::Gene*, XEPL::String* )
+	{
+		shared_gene = new XEPL::Gene ( nullptr, "shared", nullptr );
+		shared_gene->Trait_Set ( "name",  "value" );
+		shared_gene->Trait_Set ( "other", "value" );
+		new XEPL::Gene ( shared_gene, "kid", nullptr );
+		shared_gene->Append_Content ( "text", 4 );
+
+		for ( long index = 0; index < lobes; ++index )
+		{
+			XEPL::Gene* config = new XEPL::Gene ( nullptr, ( "reader" + std::to_string ( index ) ).c_str(), nullptr );
+			( new Reader ( _neuron, config ) )->Start_Lobe();
+			config->Release();
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		readers_go = true;
+
+		while ( readers_done < lobes )
+			std::this_thread::yield();
+
+		double seconds = std::chrono::duration<double> ( std::chrono::steady_clock::now() - start ).count();
+		std::cout << lobes << " lobes: " << seconds << "s " << lobes*rounds*3/seconds/1e6 << " M reads/s\n" << std::flush;
+
+		for ( long index = 0; index < lobes; ++index )
+			_neuron->Drop_Neuron ( "reader" + std::to_string ( index ) );
+
+		shared_gene->Release();
+	} );
+
+	cortex.Execute_As_Xml ( "<Bench/>" );
+}
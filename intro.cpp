@@ -19,6 +19,7 @@ int main ( int, char**, char** )
 			cortex.Register_Command ( "Trace",     [] ( XEPL::String* _opt ) { XEPL::Show_Trace          = _opt->compare("off"); });
 			cortex.Register_Command ( "Counters",  [] ( XEPL::String* _opt ) { XEPL::Show_Counters       = _opt->compare("off"); });
 			cortex.Register_Command ( "Memory",    [] ( XEPL::String* _opt ) { XEPL::Show_Memory_Counts  = _opt->compare("off"); });
+			cortex.Register_Command ( "Profile",   [] ( XEPL::String* _opt ) { XEPL::Show_Memory_Profile = _opt->compare("off"); });
 			
 			reboot = KITS::CLI::CliLoop(std::cin, std::cout, std::cerr);
 
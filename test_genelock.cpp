@@ -0,0 +1,117 @@
+#include "xepl.hpp"
+#include <chrono>
+
+// Each Gene locks alone: a Gene held shared lets another be written, nested writers on their own Genes never meet
+//   g++ -std=c++17 -O2 -pthread test_genelock.cpp -o test_genelock && ./test_genelock
+
+static const long        genes_each = 4096;
+static const long        rounds     = 4;
+static std::atomic_long  writers_done { 0 };
+static int               failures   = 0;
+
+static void Expect ( const char* _what, bool _held )
+{
+	std::cout << ( _held ? "ok   " : "FAIL " ) << _what << "\n" << std::flush;
+	if ( !_held )
+		++failures;
+}
+
+static XEPL::Gene* Make_Genes ( const char* _name )
+{
+	XEPL::Gene* root = new XEPL::Gene ( nullptr, _name, nullptr );
+	for ( long index = 0; index < genes_each; ++index )
+		new XEPL::Gene ( root, "g", nullptr );
+	return root;
+}
+
+class Writer : public XEPL::Lobe
+{
+	bool benched = false;
+public:
+	Writer ( XEPL::Neuron* _parent, XEPL::Gene* _config ) : Lobe ( _parent, _config ) {}
+	void Lobe_Rest_Now ( void ) override
+	{
+		if ( !benched )
+		{
+			benched = true;
+
+			// write one Gene while holding another exclusive, across every pair a stripe table would have folded
+			XEPL::Gene*      root = Make_Genes ( "own" );
+			XEPL::StableGenes genes ( root );
+			std::vector<XEPL::Gene*> list;
+			XEPL::Gene* gene = nullptr;
+			while ( genes.Next_Gene ( &gene ) )
+				list.push_back ( gene );
+
+			for ( long round = 0; round < rounds; ++round )
+				for ( size_t index = 0; index < list.size(); ++index )
+				{
+					XEPL::WriteScope hold ( list[index]->Lock_Gene() );
+					std::this_thread::yield();
+					list[( index*7 + round + 1 ) % list.size()]->Trait_Set ( "n", "1" );
+				}
+
+			root->Release();
+			++writers_done;
+		}
+		Lobe::Lobe_Rest_Now();
+	}
+};
+
+int main ( int, char**, char** )
+{
+	{
+		XEPL::Cortex cortex ( "brain", std::cout );
+
+		cortex.Register_Keyword ( "Locks", [] ( XEPL::Neuron* _neuron, XEPL::Gene*, XEPL::String* )
+		{
+			XEPL::Gene* root = Make_Genes ( "read" );
+
+			for ( long held = 0; held < 16; ++held )
+			{
+				XEPL::StableGenes genes ( root );
+				XEPL::Gene*       gene = nullptr;
+
+				for ( long index = 0; index <= held; ++index )
+					genes.Next_Gene ( &gene );
+
+				XEPL::ReadScope hold ( gene->Read_Lock() );
+				XEPL::StableGenes others ( root );
+				XEPL::Gene*       other = nullptr;
+
+				while ( others.Next_Gene ( &other ) )
+					if ( other != gene )
+						other->Trait_Set ( "n", "1" );
+			}
+			root->Release();
+			Expect ( "a Gene held shared lets every other Gene be written", true );
+
+			for ( const char* name : { "writer0", "writer1", "writer2", "writer3" } )
+			{
+				XEPL::Gene* config = new XEPL::Gene ( nullptr, name, nullptr );
+				( new Writer ( _neuron, config ) )->Start_Lobe();
+				config->Release();
+			}
+
+			auto start = std::chrono::steady_clock::now();
+			while ( writers_done < 4 && std::chrono::steady_clock::now() - start < std::chrono::seconds ( 30 ) )
+				std::this_thread::sleep_for ( std::chrono::milliseconds ( 10 ) );
+
+			Expect ( "nested writers on their own Genes never deadlock", writers_done == 4 );
+
+			if ( writers_done < 4 )
+			{
+				std::cout << "FAILED\n" << std::flush;
+				std::_Exit ( 1 );
+			}
+
+			for ( const char* name : { "writer0", "writer1", "writer2", "writer3" } )
+				_neuron->Drop_Neuron ( name );
+		} );
+
+		cortex.Execute_As_Xml ( "<Locks/>" );
+	}
+
+	std::cout << ( failures ? "FAILED\n" : "passed\n" ) << std::flush;
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,84 @@
+#include "xepl.hpp"
+
+// Changes to a Gene another Lobe owns: posted ones land by Owner_Wait, answering ones run on the owner while the caller waits
+//   g++ -std=c++17 -O2 -pthread test_owner.cpp -o test_owner && ./test_owner
+
+static int failures = 0;
+
+static void Expect ( const char* _what, bool _held )
+{
+	std::cout << ( _held ? "ok   " : "FAIL " ) << _what << "\n";
+	if ( !_held )
+		++failures;
+}
+
+static void Expect ( const char* _what, XEPL::Gene* _gene, const char* _printed )
+{
+	XEPL::String printed;
+	_gene->Print_Into ( &printed );
+
+	Expect ( _what, !printed.compare ( _printed ) );
+	if ( printed.compare ( _printed ) )
+		std::cout << "  got:    " << printed << "\n  wanted: " << _printed << "\n";
+}
+
+class Owner : public XEPL::Lobe
+{
+public:
+	Owner ( XEPL::Neuron* _parent, XEPL::Gene* _config ) : Lobe ( _parent, _config ) {}
+};
+
+int main ( int, char**, char** )
+{
+	{
+		XEPL::Cortex cortex ( "brain", std::cout );
+
+		cortex.Register_Keyword ( "Owned", [] ( XEPL::Neuron* _neuron, XEPL::Gene*, XEPL::String* )
+		{
+			XEPL::Gene* config = new XEPL::Gene ( nullptr, "owner", nullptr );
+			Owner*      owner  = new Owner ( _neuron, config );
+			owner->Start_Lobe();
+			config->Release();
+
+			XEPL::Gene* observer = owner->observer;
+			Expect ( "a started Lobe owns its observer", observer->Owner_Lobe() == owner && observer->Remote_Owner() );
+
+			XEPL::Gene* remote = observer->Make_One ( "Remote" );
+			Expect ( "Make_One answers with the Gene the owner made", remote && remote == observer->Make_One ( "Remote" ) );
+			Expect ( "a Gene made by the owner is owned by it", remote && remote->Owner_Lobe() == owner );
+
+			remote->Trait_Set ( "a", "1" );
+			remote->Assign_Content ( "text" );
+			remote->Owner_Wait();
+
+			XEPL::String term;
+			Expect ( "a posted Trait has landed after Owner_Wait", remote->Trait_Get ( "a", &term ) && !term.compare ( "1" ) );
+
+			XEPL::Gene* kid  = nullptr;
+			XEPL::Gene* same = nullptr;
+			bool        made = remote->Make_One_Gene ( "kid", &kid );
+			Expect ( "Make_One_Gene makes once", made && kid && !remote->Make_One_Gene ( "kid", &same ) && same == kid );
+
+			XEPL::Cord* tapped = remote->Trait_Tap ( "t", "d" );
+			Expect ( "Trait_Tap answers with the owner's term", tapped && !tapped->compare ( "d" ) );
+
+			XEPL::Gene* other = new XEPL::Gene ( nullptr, "kid", nullptr );
+			other->Trait_Set ( "new", "1" );
+			XEPL::String kid_name ( "kid" );
+			Expect ( "Replace_Gene answers whether it replaced", remote->Replace_Gene ( &kid_name, other ) );
+			other->Release();
+
+			Expect ( "Make_Content is refused from another Lobe", remote->Make_Content() == nullptr );
+			Expect ( "Share_Content answers with the owner's Wire", remote->Share_Content() != nullptr );
+
+			Expect ( "every change landed on the owner", remote, R"(<Remote a="1" t="d">text<kid new="1"/></Remote>)" );
+
+			_neuron->Drop_Neuron ( "owner" );
+		} );
+
+		cortex.Execute_As_Xml ( "<Owned/>" );
+	}
+
+	std::cout << ( failures ? "FAILED\n" : "passed\n" ) << std::flush;
+	return failures ? 1 : 0;
+}
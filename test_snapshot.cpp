@@ -0,0 +1,135 @@
+#include "xepl.hpp"
+
+// GeneSnapshots read by Lobes while another Lobe keeps changing the Genes under them
+//   g++ -std=c++17 -O2 -pthread test_snapshot.cpp -o test_snapshot && ./test_snapshot
+
+static XEPL::Gene*      root_gene = nullptr;
+static std::atomic_bool writing   { true };
+static std::atomic_long readers_done { 0 };
+static std::atomic_long snapshots { 0 };
+static std::atomic_long torn      { 0 };
+static int              failures  = 0;
+
+static void Expect ( const char* _what, bool _held )
+{
+	std::cout << ( _held ? "ok   " : "FAIL " ) << _what << "\n";
+	if ( !_held )
+		++failures;
+}
+
+class Reader : public XEPL::Lobe
+{
+	bool benched = false;
+public:
+	Reader ( XEPL::Neuron* _parent, XEPL::Gene* _config ) : Lobe ( _parent, _config ) {}
+	void Lobe_Rest_Now ( void ) override
+	{
+		if ( !benched )
+		{
+			benched = true;
+
+			while ( writing )
+			{
+				XEPL::GeneSnapshot snapshot ( root_gene );
+
+				XEPL::String first;
+				snapshot.version->Print_Into ( &first );
+
+				std::this_thread::yield();
+
+				XEPL::String again;
+				snapshot.version->Print_Into ( &again );
+
+				if ( first.compare ( again ) )
+					++torn;
+
+				++snapshots;
+			}
+			++readers_done;
+		}
+		Lobe::Lobe_Rest_Now();
+	}
+};
+
+int main ( int, char**, char** )
+{
+	{
+		XEPL::Cortex cortex ( "brain", std::cout );
+
+		cortex.Register_Keyword ( "Snapshots", [] ( XEPL::Neuron* _neuron, XEPL::Gene*, XEPL::String* )
+		{
+			root_gene = new XEPL::Gene ( nullptr, "root", nullptr );
+
+			std::vector<XEPL::Gene*> branches;
+			for ( int branch = 0; branch < 16; ++branch )
+			{
+				branches.push_back ( new XEPL::Gene ( root_gene, "branch", nullptr ) );
+				for ( int leaf = 0; leaf < 16; ++leaf )
+					new XEPL::Gene ( branches.back(), "leaf", nullptr );
+			}
+
+			// a Gene under two parents is never cached, its versions belong to the snapshot
+			XEPL::Gene* shared = new XEPL::Gene ( branches[0], "shared", nullptr );
+			branches[1]->Add_Gene ( shared );
+			shared->Attach();
+
+			XEPL::String before;
+			XEPL::GeneSnapshot held ( root_gene );
+			held.version->Print_Into ( &before );
+
+			for ( const char* name : { "reader0", "reader1", "reader2" } )
+			{
+				XEPL::Gene* config = new XEPL::Gene ( nullptr, name, nullptr );
+				( new Reader ( _neuron, config ) )->Start_Lobe();
+				config->Release();
+			}
+
+			for ( int edit = 0; edit < 20000; ++edit )
+			{
+				XEPL::Gene* branch = branches[edit % 16];
+				branch->First()->Trait_Set ( "v", std::to_string ( edit ).c_str() );
+				shared->Trait_Set ( "v", std::to_string ( edit ).c_str() );
+
+				if ( edit % 7 == 0 )
+					new XEPL::Gene ( branch, "leaf", nullptr );
+
+				if ( edit % 11 == 0 )
+					branch->Remove_Gene ( branch->First() );
+
+				if ( edit % 64 == 0 )
+					std::this_thread::yield();
+			}
+			writing = false;
+
+			while ( readers_done < 3 )
+				std::this_thread::sleep_for ( std::chrono::milliseconds ( 1 ) );
+
+			Expect ( "readers took snapshots while the Genes changed", snapshots > 0 );
+			Expect ( "a snapshot prints the same every time it is read", torn == 0 );
+
+			XEPL::String after;
+			held.version->Print_Into ( &after );
+			Expect ( "a snapshot held across the writes still prints as it did", !before.compare ( after ) );
+
+			XEPL::String live;
+			XEPL::String latest;
+			root_gene->Print_Into ( &live );
+			{
+				XEPL::GeneSnapshot snapshot ( root_gene );
+				snapshot.version->Print_Into ( &latest );
+			}
+			Expect ( "a snapshot taken after the writes matches the Genes", !live.compare ( latest ) );
+
+			for ( const char* name : { "reader0", "reader1", "reader2" } )
+				_neuron->Drop_Neuron ( name );
+
+			shared->Release();
+			root_gene->Release();
+		} );
+
+		cortex.Execute_As_Xml ( "<Snapshots/>" );
+	}
+
+	std::cout << ( failures ? "FAILED\n" : "passed\n" ) << std::flush;
+	return failures ? 1 : 0;
+}
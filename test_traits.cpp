@@ -0,0 +1,55 @@
+#include "xepl.hpp"
+
+// Pins the order Traits keep, see Trait order in README.md
+//   g++ -std=c++17 -O2 -pthread test_traits.cpp -o test_traits && ./test_traits
+
+static int failures = 0;
+
+static void Expect ( const char* _what, XEPL::Gene* _gene, const char* _printed )
+{
+	XEPL::String printed;
+	_gene->Print_Into ( &printed );
+
+	if ( printed.compare ( _printed ) )
+	{
+		std::cout << "FAIL " << _what << "\n  got:    " << printed << "\n  wanted: " << _printed << "\n";
+		++failures;
+	}
+	else
+		std::cout << "ok   " << _what << "\n";
+}
+
+int main ( int, char**, char** )
+{
+	{
+		XEPL::Cortex cortex ( "brain", std::cout );
+
+		cortex.Register_Keyword ( "Traits", [] ( XEPL::Neuron*, XEPL::Gene* _call_gene, XEPL::String* )
+		{
+			XEPL::Gene* parsed = _call_gene->First();
+			Expect ( "parsed attributes print in document order", parsed, R"(<a x="1" y="2" z="3"/>)" );
+
+			XEPL::Gene* duplicate = nullptr;
+			parsed->Duplicate_Gene ( &duplicate );
+			Expect ( "a duplicate keeps the order", duplicate, R"(<a x="1" y="2" z="3"/>)" );
+
+			duplicate->Trait_Set ( "w", "0" );
+			duplicate->Trait_Set ( "y", "5" );
+			Expect ( "a new name goes last, a reset name keeps its place", duplicate, R"(<a x="1" y="5" z="3" w="0"/>)" );
+
+			XEPL::Gene* absorbing = new XEPL::Gene ( nullptr, "b", nullptr );
+			absorbing->Trait_Set ( "z", "9" );
+			absorbing->Trait_Set ( "q", "8" );
+			absorbing->Absorb_Traits ( parsed );
+			Expect ( "absorbed names overwrite in place, new ones append", absorbing, R"(<b z="3" q="8" x="1" y="2"/>)" );
+
+			absorbing->Release();
+			duplicate->Release();
+		} );
+
+		cortex.Execute_As_Xml ( "<Traits><a x='1' y='2' z='3'/></Traits>" );
+	}
+
+	std::cout << ( failures ? "FAILED\n" : "passed\n" ) << std::flush;
+	return failures ? 1 : 0;
+}
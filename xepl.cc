@@ -24,6 +24,19 @@
 
 #include "xepl.h"
 
+#ifdef __GLIBC__
+#include <execinfo.h>
+#endif
+#ifdef __GNUG__
+#include <cxxabi.h>
+#endif
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
 /// This detects C++ memory leaks
 
 std::atomic_size_t XEPL::num_total_news{0};
@@ -43,6 +56,11 @@ void operator delete ( void* _ptr ) throw()
 	free ( _ptr );
 }
 
+void operator delete ( void* _ptr, size_t ) throw()
+{
+	::operator delete ( _ptr );
+}
+
 XEPL::MemoryCounts::~MemoryCounts()
 {
 	size_t leaking_allocations = num_total_news-num_total_dels;
@@ -88,6 +106,247 @@ XEPL::MutexScope::MutexScope ( Mutex* _mutex )
 	if ( mutex )
 		mutex->mutex.lock();
 }
+
+namespace XEPL
+{
+	/// a Gene lock this thread holds, and how deeply
+	struct HeldGene
+	{
+		Atom* gene;
+		int   readers;
+		int   writers;
+	};
+
+	static thread_local HeldGene held_genes[Memory::heldGenes];
+	static thread_local int      held_count = 0;
+
+	static HeldGene* Held_Gene ( Atom* _gene )
+	{
+		for ( int i = held_count; i--; )
+			if ( held_genes[i].gene == _gene )
+				return &held_genes[i];
+
+		return nullptr;
+	}
+
+	static void Remember_Gene ( Atom* _gene, int _readers, int _writers )
+	{
+		if ( held_count == Memory::heldGenes )
+			GeneLock::Refuse ( "too many Genes held at once" );
+
+		held_genes[held_count++] = HeldGene { _gene, _readers, _writers };
+	}
+
+	static void Forget_Gene ( HeldGene* _held )
+	{
+		*_held = held_genes[--held_count];
+	}
+}
+
+void XEPL::GeneLock::Refuse ( Text* _misuse )
+{
+	{
+		ErrorReport error_report ( "GeneLock: ", _misuse );
+	}
+	std::abort();
+}
+
+void XEPL::GeneLock::Hold_Link ( Atom* _gene )
+{
+	while ( _gene->atom_flags.fetch_or ( link_flag, std::memory_order_acquire ) & link_flag )
+		std::this_thread::yield();
+}
+
+void XEPL::GeneLock::Drop_Link ( Atom* _gene )
+{
+	_gene->atom_flags.fetch_and ( ~link_flag, std::memory_order_release );
+}
+
+void XEPL::GeneLock::Hold_Shared ( Atom* _gene )
+{
+	if ( HeldGene* held = Held_Gene ( _gene ) )
+	{
+		++held->readers;
+		return;
+	}
+
+	std::atomic_long& word = _gene->atom_flags;
+	AtomFlags         was  = word.load ( std::memory_order_relaxed );
+
+	for (;;)
+	{
+		if ( was & ( lock_writer | lock_waiting ) )
+		{
+			std::this_thread::yield();
+			was = word.load ( std::memory_order_relaxed );
+		}
+		else if ( word.compare_exchange_weak ( was, was + lock_reader, std::memory_order_acquire, std::memory_order_relaxed ) )
+			break;
+	}
+
+	Remember_Gene ( _gene, 1, 0 );
+}
+
+void XEPL::GeneLock::Drop_Shared ( Atom* _gene )
+{
+	HeldGene* held = Held_Gene ( _gene );
+
+	if ( --held->readers || held->writers )
+		return;
+
+	_gene->atom_flags.fetch_sub ( lock_reader, std::memory_order_release );
+	Forget_Gene ( held );
+}
+
+void XEPL::GeneLock::Hold_Exclusive ( Atom* _gene )
+{
+	if ( HeldGene* held = Held_Gene ( _gene ) )
+	{
+		// upgrades are refused: another writer could get in between
+		// dropping the read and taking the write, under a reader that thinks it still holds the Gene
+		if ( !held->writers )
+			Refuse ( "upgraded from shared to exclusive" );
+
+		++held->writers;
+		return;
+	}
+
+	std::atomic_long& word = _gene->atom_flags;
+	AtomFlags         was  = word.load ( std::memory_order_relaxed );
+
+	for (;;)
+	{
+		if ( was & ( lock_writer | lock_readers ) )
+		{
+			if ( !( was & lock_waiting ) )
+				word.fetch_or ( lock_waiting, std::memory_order_relaxed );
+
+			std::this_thread::yield();
+			was = word.load ( std::memory_order_relaxed );
+		}
+		else if ( word.compare_exchange_weak ( was, ( was | lock_writer ) & ~lock_waiting, std::memory_order_acquire, std::memory_order_relaxed ) )
+			break;
+	}
+
+	Remember_Gene ( _gene, 0, 1 );
+}
+
+void XEPL::GeneLock::Drop_Exclusive ( Atom* _gene )
+{
+	HeldGene* held = Held_Gene ( _gene );
+
+	if ( --held->writers )
+		return;
+
+	if ( held->readers )
+		_gene->atom_flags.fetch_add ( lock_reader - lock_writer, std::memory_order_release );
+	else
+	{
+		_gene->atom_flags.fetch_and ( ~lock_writer, std::memory_order_release );
+		Forget_Gene ( held );
+	}
+}
+
+XEPL::ReadScope::~ReadScope ( void )
+{
+	if ( locked_gene )
+		GeneLock::Drop_Shared ( locked_gene );
+}
+
+XEPL::ReadScope::ReadScope ( Atom* _gene )
+: locked_gene ( _gene )
+{
+	if ( locked_gene )
+		GeneLock::Hold_Shared ( locked_gene );
+}
+
+XEPL::WriteScope::~WriteScope ( void )
+{
+	if ( locked_gene )
+		GeneLock::Drop_Exclusive ( locked_gene );
+}
+
+XEPL::WriteScope::WriteScope ( Atom* _gene )
+: locked_gene ( _gene )
+{
+	if ( locked_gene )
+		GeneLock::Hold_Exclusive ( locked_gene );
+}
+
+namespace XEPL
+{
+	/// one reader slot of the epoch table, alone on its cache line
+	struct alignas ( Memory::cacheLine ) EpochSlot
+	{
+		std::atomic_long  pinned_epoch { 0 };
+		std::atomic_bool  slot_taken   { false };
+	};
+
+	/// the slot this thread pins, handed back when the thread ends
+	struct EpochClaim
+	{
+		EpochSlot*  slot  = nullptr;
+		long        depth = 0;
+		~EpochClaim ( void ) { if ( slot ) slot->slot_taken = false; }
+	};
+
+	static EpochSlot          epoch_slots[Memory::epochSlots];
+	static std::atomic_long   global_epoch { 1 };
+
+	static thread_local EpochClaim epoch_claim;
+
+	static SpinLock           retired_lock;
+	static GeneVersion*       retired_versions = nullptr;
+	static std::atomic_long   retired_count { 0 };
+
+	static EpochSlot* Claim_Epoch_Slot ( void )
+	{
+		for ( ;; )
+		{
+			for ( auto& slot : epoch_slots )
+				if ( !slot.slot_taken.exchange ( true ) )
+					return &slot;
+
+			std::this_thread::yield();
+		}
+	}
+}
+
+XEPL::EpochScope::~EpochScope ( void )
+{
+	if ( --epoch_claim.depth )
+		return;
+
+	epoch_claim.slot->pinned_epoch = 0;
+
+	if ( retired_count.load ( std::memory_order_relaxed ) )
+		GeneVersion::Reclaim();
+}
+
+XEPL::EpochScope::EpochScope ( void )
+{
+	if ( epoch_claim.depth++ )
+		return;
+
+	if ( !epoch_claim.slot )
+		epoch_claim.slot = Claim_Epoch_Slot();
+
+	epoch_claim.slot->pinned_epoch = global_epoch.load();
+}
+
+long XEPL::EpochScope::Oldest_Pinned ( void )
+{
+	long oldest = global_epoch.load();
+
+	for ( auto& slot : epoch_slots )
+	{
+		long pinned = slot.pinned_epoch.load();
+		if ( pinned && pinned < oldest )
+			oldest = pinned;
+	}
+
+	return oldest;
+}
  //   d888888P dP                                        dP
 //      88    88                                        88
 //      88    88d888b. 88d888b. .d8888b. .d8888b. .d888b88
@@ -122,10 +381,14 @@ void XEPL::Thread::Concieve_Child( Semaphore* _semaphore )
 	{
 		tlsLobe = _thread->lobe;
 
-		Backpack     memory_backpack;
+		Backpack     memory_backpack ( cortex ? cortex->memory_backpack.page_policy : standard_pages );
 		ShortTerms   short_term_memories;
 
+		OwnerBias::Claim_Thread();
+
 		tlsLobe->Main_Loop( _semaphore );
+
+		OwnerBias::Vacate_Thread();
 	}, this );
 }
 
@@ -187,6 +450,26 @@ XEPL::String::String ( Text* _string, size_t _length )
 		assign ( _string, _length );
 }
 
+XEPL::String::String ( const String& _string )
+	: CppString ( _string )
+{}
+
+XEPL::String::String ( String&& _string ) noexcept
+	: CppString ( std::move ( _string ) )
+{}
+
+XEPL::String& XEPL::String::operator= ( const String& _string )
+{
+	CppString::operator= ( _string );
+	return *this;
+}
+
+XEPL::String& XEPL::String::operator= ( String&& _string ) noexcept
+{
+	CppString::operator= ( std::move ( _string ) );
+	return *this;
+}
+
 std::ostream& operator<< (std::ostream& os, XEPL::Cord* str)
 {
 	return os << str->c_str();
@@ -197,6 +480,179 @@ std::ostream& operator<< (std::ostream& os, XEPL::Cord& str)
 	return os << str.c_str();
 }
 
+//   .d88888b                      dP                dP
+//   88.    "'                     88                88
+//   `Y88888b. dP    dP 88d8b.d8b. 88d888b. .d8888b. 88 .d8888b.
+//         `8b 88    88 88'`88'`88 88'  `88 88'  `88 88 Y8ooooo.
+//   d8'   .8P 88.  .88 88  88  88 88.  .88 88.  .88 88       88
+//    Y88888P  `8888P88 dP  dP  dP 88Y8888' `88888P' dP `88888P'
+//                  .88
+//              d8888P
+
+XEPL::Symbols XEPL::Symbols::symbol_shards[Memory::symbolShards];
+
+XEPL::Symbol::Symbol ( Text* _chars, size_t _length, size_t _hash, Symbol* _next )
+	: String      ( _chars, _length )
+	, next_symbol ( _next )
+	, symbol_hash ( _hash )
+{}
+
+size_t XEPL::Symbols::Hash_Text ( Text* _chars, size_t _length )
+{
+	return std::hash<std::string_view>() ( std::string_view ( _chars, _length ) );
+}
+
+XEPL::SymbolTable* XEPL::SymbolTable::Create ( size_t _buckets, SymbolTable* _retired )
+{
+	SymbolTable* table = static_cast<SymbolTable*> ( calloc ( 1, sizeof ( SymbolTable ) + _buckets*sizeof ( std::atomic<Symbol*> ) ) );
+	table->retired_table = _retired;
+	table->bucket_mask   = _buckets-1;
+	return table;
+}
+
+XEPL::Symbol* XEPL::Symbols::Lookup ( Text* _chars, size_t _length, size_t _hash )
+{
+	SymbolTable* table = symbol_table.load ( std::memory_order_acquire );
+
+	if ( !table )
+		return nullptr;
+
+	Symbol* symbol = table->Heads()[ ( _hash / Memory::symbolShards ) & table->bucket_mask ].load ( std::memory_order_acquire );
+
+	while ( symbol )
+	{
+		if ( symbol->symbol_hash == _hash && symbol->size() == _length && !std::memcmp ( symbol->data(), _chars, _length ) )
+			return symbol;
+
+		symbol = symbol->next_symbol.load ( std::memory_order_acquire );
+	}
+	return nullptr;
+}
+
+XEPL::Symbol* XEPL::Symbols::Insert ( Text* _chars, size_t _length, size_t _hash )
+{
+	SymbolTable* table = symbol_table.load ( std::memory_order_relaxed );
+
+	if ( symbol_count >= ( table ? table->bucket_mask+1 : 0 ) )
+	{
+		size_t       count    = table ? 2*( table->bucket_mask+1 ) : Memory::symbolBuckets;
+		SymbolTable* grown    = SymbolTable::Create ( count, table );
+		size_t       sequence = grow_sequence.load ( std::memory_order_relaxed );
+
+		grow_sequence.store ( sequence+1, std::memory_order_relaxed );
+
+		for ( size_t index = 0; table && index <= table->bucket_mask; ++index )
+		{
+			std::atomic<Symbol*>& bucket = table->Heads()[index];
+
+			while ( Symbol* symbol = bucket.load ( std::memory_order_relaxed ) )
+			{
+				bucket.store ( symbol->next_symbol.load ( std::memory_order_relaxed ), std::memory_order_release );
+				std::atomic<Symbol*>& head = grown->Heads()[ ( symbol->symbol_hash / Memory::symbolShards ) & ( count-1 ) ];
+				symbol->next_symbol.store ( head.load ( std::memory_order_relaxed ), std::memory_order_release );
+				head.store ( symbol, std::memory_order_relaxed );
+			}
+		}
+
+		symbol_table.store ( grown, std::memory_order_release );
+		grow_sequence.store ( sequence+2, std::memory_order_release );
+		table = grown;
+	}
+
+	std::atomic<Symbol*>& head = table->Heads()[ ( _hash / Memory::symbolShards ) & table->bucket_mask ];
+	Symbol* symbol = new Symbol ( _chars, _length, _hash, head.load ( std::memory_order_relaxed ) );
+	head.store ( symbol, std::memory_order_release );
+	++symbol_count;
+
+	return symbol;
+}
+
+XEPL::Cord* XEPL::Symbols::Intern ( Cord* _name )
+{
+	return Intern ( _name->data(), _name->size() );
+}
+
+XEPL::Cord* XEPL::Symbols::Intern ( Text* _chars )
+{
+	return Intern ( _chars, std::strlen ( _chars ) );
+}
+
+XEPL::Cord* XEPL::Symbols::Intern ( Text* _chars, size_t _length )
+{
+	size_t   hash  = Hash_Text ( _chars, _length );
+	Symbols& shard = symbol_shards[hash % Memory::symbolShards];
+
+	if ( Symbol* symbol = shard.Lookup ( _chars, _length, hash ) )
+		return symbol;
+
+	std::lock_guard<std::mutex> lock_shard ( shard.shard_lock );
+
+	if ( Symbol* symbol = shard.Lookup ( _chars, _length, hash ) )
+		return symbol;
+
+	return shard.Insert ( _chars, _length, hash );
+}
+
+XEPL::Cord* XEPL::Symbols::Find ( std::string_view _name )
+{
+	size_t   hash     = Hash_Text ( _name.data(), _name.size() );
+	Symbols& shard    = symbol_shards[hash % Memory::symbolShards];
+	size_t   sequence = shard.grow_sequence.load ( std::memory_order_acquire );
+
+	if ( !( sequence & 1 ) )
+	{
+		if ( Symbol* symbol = shard.Lookup ( _name.data(), _name.size(), hash ) )
+			return symbol;
+
+		if ( shard.grow_sequence.load ( std::memory_order_acquire ) == sequence )
+			return nullptr;
+	}
+
+	std::lock_guard<std::mutex> lock_shard ( shard.shard_lock );
+
+	return shard.Lookup ( _name.data(), _name.size(), hash );
+}
+
+size_t XEPL::Symbols::Count ( void )
+{
+	size_t count = 0;
+
+	for ( Symbols& shard : symbol_shards )
+	{
+		std::lock_guard<std::mutex> lock_shard ( shard.shard_lock );
+		count += shard.symbol_count;
+	}
+	return count;
+}
+
+void XEPL::Symbols::Release_Symbols ( void )
+{
+	for ( Symbols& shard : symbol_shards )
+	{
+		std::lock_guard<std::mutex> lock_shard ( shard.shard_lock );
+
+		SymbolTable* table = shard.symbol_table.exchange ( nullptr );
+
+		for ( size_t index = 0; table && index <= table->bucket_mask; ++index )
+		{
+			while ( Symbol* symbol = table->Heads()[index].load() )
+			{
+				table->Heads()[index] = symbol->next_symbol.load();
+				delete symbol;
+			}
+		}
+
+		while ( table )
+		{
+			SymbolTable* retired = table->retired_table;
+			free ( table );
+			table = retired;
+		}
+
+		shard.symbol_count = 0;
+	}
+}
+
 //    888888ba                    dP                                  dP
 //    88    `8b                   88                                  88
 //   a88aaaa8P' .d8888b. .d8888b. 88  .dP  88d888b. .d8888b. .d8888b. 88  .dP
@@ -210,15 +666,40 @@ XEPL::Backpack::~Backpack()
 	heap->~HeapOfPools();
 	free ( heap );
 
-	tlsHeap = nullptr;
+	tlsHeap = previous_heap;
 }
 
-XEPL::Backpack::Backpack()
-	: heap (  new ( malloc ( sizeof ( HeapOfPools ) ) ) HeapOfPools() )
+XEPL::Backpack::Backpack ( PagePolicy _policy )
+	: heap          ( new ( malloc ( sizeof ( HeapOfPools ) ) ) HeapOfPools ( _policy ) )
+	, previous_heap ( tlsHeap )
+	, page_policy   ( _policy )
 {
 	tlsHeap = heap;
 }
 
+thread_local bool XEPL::ThreadBackpack::backpack_unpacked = false;
+
+XEPL::ThreadBackpack::~ThreadBackpack()
+{
+	backpack_unpacked = true;
+}
+
+XEPL::ThreadBackpack::ThreadBackpack ( void )
+	: Backpack ( standard_pages )
+{
+	++total_thread_heaps;
+}
+
+XEPL::HeapOfPools* XEPL::ThreadBackpack::Thread_Heap ( void )
+{
+	if ( backpack_unpacked )
+		return nullptr;
+
+	static thread_local ThreadBackpack thread_backpack;
+
+	return tlsHeap;
+}
+
 //    888888ba                                      dP
 //    88    `8b                                     88
 //   a88aaaa8P' .d8888b. .d8888b. dP    dP .d8888b. 88 .d8888b. 88d888b.
@@ -230,55 +711,195 @@ XEPL::Backpack::Backpack()
 
 void* XEPL::Recycler::operator new ( size_t size )
 {
-	if ( HeapOfPools* heap = tlsHeap )
-		return heap->Get_Block ( size );
+	if ( HeapOfPools* heap = tlsHeap ? tlsHeap : ThreadBackpack::Thread_Heap() )
+	{
+		void* block = heap->Get_Block ( size );
+		if ( Show_Memory_Profile )
+			heap->Profile_New ( 0, block );
+		return block;
+	}
 
-	return ::operator new ( size );
+	return HeapOfPools::Orphan_New ( size );
 }
 
 void XEPL::Recycler::operator delete ( void* p )
 {
 	if ( HeapOfPools* heap = tlsHeap )
+	{
+		if ( Show_Memory_Profile && p )
+			heap->Profile_Delete ( 0, p );
 		heap->Recycle_Block ( p );
+	}
 	else
-		::operator delete ( p );
+		HeapOfPools::Orphan_Free ( p );
 }
-//   dP     dP                              .88888.  .8888b  888888ba                    dP
-//   88     88                             d8'   `8b 88   "  88    `8b                   88
-//   88aaaaa88a .d8888b. .d8888b. 88d888b. 88     88 88aaa  a88aaaa8P' .d8888b. .d8888b. 88 .d8888b.
-//   88     88  88ooood8 88'  `88 88'  `88 88     88 88      88        88'  `88 88'  `88 88 Y8ooooo.
-//   88     88  88.  ... 88.  .88 88.  .88 Y8.   .8P 88      88        88.  .88 88.  .88 88       88
-//   dP     dP  `88888P' `88888P8 88Y888P'  `8888P'  dP      dP        `88888P' `88888P' dP `88888P'
-//                                88
-//                                dP
-
-thread_local class XEPL::HeapOfPools* XEPL::tlsHeap = nullptr;
 
-XEPL::HeapOfPools::~HeapOfPools()
+void* XEPL::Recycler::Profiled_New ( size_t size, long type_tag, ScratchArena* arena )
 {
-	total_biggies_out += count_biggies_out;
-	total_biggies_in  += count_biggies_in;
-
-	if ( largest_biggie < largest_biggie_out )
-		largest_biggie = largest_biggie_out; // may overwrite on race
-
-	for ( long index = 1; index <= Memory::maxPoolIndex; ++index )
+	if ( HeapOfPools* heap = tlsHeap ? tlsHeap : ThreadBackpack::Thread_Heap() )
 	{
-		pool_of_blocks[index]->~PoolOfBlocks();
-		free ( pool_of_blocks[index] );
+		void* block = arena ? arena->Get_Block ( size ) : nullptr;
+		if ( !block )
+			block = heap->Get_Block ( size );
+		heap->Profile_New ( type_tag, block );
+		return block;
 	}
+
+	return HeapOfPools::Orphan_New ( size );
 }
 
-XEPL::HeapOfPools::HeapOfPools()
-	: pool_of_blocks  ()
-	, count_biggies_out    ( 0 )
-	, count_biggies_in     ( 0 )
-	, largest_biggie_out   ( 0 )
+void XEPL::Recycler::Profiled_Delete ( void* p, long type_tag )
 {
-	for ( long index = 1; index <= Memory::maxPoolIndex; ++index )
+	if ( HeapOfPools* heap = tlsHeap )
+	{
+		if ( p )
+			heap->Profile_Delete ( type_tag, p );
+		heap->Recycle_Block ( p );
+	}
+	else
+		HeapOfPools::Orphan_Free ( p );
+}
+
+void* XEPL::Recycler::operator new ( size_t size, ScratchArena* arena )
+{
+	if ( Show_Memory_Profile )
+		return Profiled_New ( size, 0, arena );
+
+	if ( arena )
+		if ( void* block = arena->Get_Block ( size ) )
+			return block;
+
+	return Recycler::operator new ( size );
+}
+
+void XEPL::Recycler::operator delete ( void* p, ScratchArena* )
+{
+	Recycler::operator delete ( p );
+}
+
+void* XEPL::CacheAlignedRecycler::operator new ( size_t size )
+{
+	if ( HeapOfPools* heap = tlsHeap ? tlsHeap : ThreadBackpack::Thread_Heap() )
+	{
+		void* block = heap->Get_Line_Block ( size );
+		if ( Show_Memory_Profile )
+			heap->Profile_New ( 0, block );
+		return block;
+	}
+
+	return HeapOfPools::Orphan_New ( size );
+}
+
+void* XEPL::CacheAlignedRecycler::operator new ( size_t size, std::align_val_t )
+{
+	return CacheAlignedRecycler::operator new ( size );
+}
+
+void XEPL::CacheAlignedRecycler::Free_Line_Block ( void* p )
+{
+	if ( HeapOfPools* heap = tlsHeap )
+	{
+		if ( Show_Memory_Profile && p )
+			heap->Profile_Delete ( 0, p );
+		heap->Recycle_Line_Block ( p );
+	}
+	else
+		HeapOfPools::Orphan_Free ( p );
+}
+
+void XEPL::CacheAlignedRecycler::operator delete ( void* p )
+{
+	Free_Line_Block ( p );
+}
+
+void XEPL::CacheAlignedRecycler::operator delete ( void* p, std::align_val_t )
+{
+	Free_Line_Block ( p );
+}
+//   dP     dP                              .88888.  .8888b  888888ba                    dP
+//   88     88                             d8'   `8b 88   "  88    `8b                   88
+//   88aaaaa88a .d8888b. .d8888b. 88d888b. 88     88 88aaa  a88aaaa8P' .d8888b. .d8888b. 88 .d8888b.
+//   88     88  88ooood8 88'  `88 88'  `88 88     88 88      88        88'  `88 88'  `88 88 Y8ooooo.
+//   88     88  88.  ... 88.  .88 88.  .88 Y8.   .8P 88      88        88.  .88 88.  .88 88       88
+//   dP     dP  `88888P' `88888P8 88Y888P'  `8888P'  dP      dP        `88888P' `88888P' dP `88888P'
+//                                88
+//                                dP
+
+thread_local class XEPL::HeapOfPools* XEPL::tlsHeap = nullptr;
+
+XEPL::HeapOfPools::~HeapOfPools()
+{
+	if ( heap_slot >= 0 )
+	{
+		void* block = RemoteInbox::inbox_slots[heap_slot].Take_Blocks ( true );
+		while ( block )
+		{
+			void* next = *static_cast<void**> ( block );
+			++count_remote_reclaimed;
+			Take_Returned ( block );
+			block = next;
+		}
+	}
+
+	total_biggies_out      += count_biggies_out;
+	total_biggies_in       += count_biggies_in;
+	total_remote_frees     += count_remote_frees;
+	total_remote_reclaimed += count_remote_reclaimed;
+	total_malloc_avoided   += count_malloc_avoided;
+
+	total_huge_pages       += count_huge_pages;
+	total_trimmed          += count_trimmed;
+	total_orphaned         += count_orphaned;
+	total_orphans_adopted  += count_adopted;
+
+	if ( profile_ticks )
+		MemoryProfile::Fold_Counts ( profile_counts );
+
+	if ( largest_biggie < largest_biggie_out )
+		largest_biggie = largest_biggie_out; // may overwrite on race
+
+	for ( long index = 1; index <= pool_count; ++index )
+	{
+		pool_of_blocks[index]->~PoolOfBlocks();
+		free ( pool_of_blocks[index] );
+	}
+
+	if ( huge_region )
+		huge_region->Release_Region();
+
+	if ( heap_slot >= 0 )
+		RemoteInbox::Release_Slot ( heap_slot );
+}
+
+XEPL::HeapOfPools::HeapOfPools ( PagePolicy _policy )
+	: pool_of_blocks  ()
+	, pool_count           ( SizeClasses::pool_count )
+	, heap_slot            ( RemoteInbox::Claim_Slot() )
+	, heap_generation      ( heap_slot >= 0 ? RemoteInbox::inbox_slots[heap_slot].slot_generation.load() : 0 )
+	, count_biggies_out    ( 0 )
+	, count_biggies_in     ( 0 )
+	, largest_biggie_out   ( 0 )
+	, count_remote_frees   ( 0 )
+	, count_remote_reclaimed ( 0 )
+	, count_malloc_avoided ( 0 )
+	, profile_ticks        ( 0 )
+	, profile_counts       ()
+	, page_policy          ( _policy )
+	, huge_region          ( nullptr )
+	, count_pages          ( 0 )
+	, count_huge_pages     ( 0 )
+	, count_huge_regions   ( 0 )
+	, count_trims          ( 0 )
+	, count_trimmed        ( 0 )
+	, bytes_trimmed        ( 0 )
+	, count_orphaned       ( 0 )
+	, count_adopted        ( 0 )
+{
+	for ( long index = 1; index <= pool_count; ++index )
 	{
 		void* ptr = malloc ( sizeof ( PoolOfBlocks ) );
-		pool_of_blocks[index] = ( new ( ptr ) PoolOfBlocks ( index ) );
+		pool_of_blocks[index] = ( new ( ptr ) PoolOfBlocks ( this, index, heap_slot, heap_generation ) );
+		pool_of_blocks[index]->slab_mode = ( ( page_policy == huge_pages || index > SizeClasses::class_count ) && heap_slot >= 0 );
 	}
 
 	pool_of_blocks[0] = nullptr;
@@ -286,13 +907,20 @@ XEPL::HeapOfPools::HeapOfPools()
 
 void* XEPL::HeapOfPools::Get_Block ( size_t _size )
 {
-	auto block_id = _size/Memory::poolWidth;
-	if ( block_id <= Memory::maxPoolIndex )
+	if ( static_cast<long> ( _size ) <= SizeClasses::pooled_limit )
 	{
-		if ( !block_id )
-			block_id = 1;
+		PoolOfBlocks* pool = pool_of_blocks[ SizeClasses::class_lookup[ ( _size+Memory::poolWidth-1 )/Memory::poolWidth ] ];
+
+		if ( !pool->head_block && !pool->free_slab && heap_slot >= 0
+			&& ( RemoteInbox::inbox_slots[heap_slot].returned_blocks.load ( std::memory_order_relaxed )
+			  || RemoteInbox::orphan_blocks.returned_blocks.load ( std::memory_order_relaxed ) ) )
+		{
+			Reclaim_Remote_Blocks();
+			if ( pool->head_block || pool->free_slab )
+				++count_malloc_avoided;
+		}
 
-		return pool_of_blocks[block_id]->Get_Or_Malloc();
+		return pool->Get_Or_Malloc();
 	}
 
 	++count_biggies_out;
@@ -303,19 +931,72 @@ void* XEPL::HeapOfPools::Get_Block ( size_t _size )
 	const size_t block_size = _size + sizeof ( BlockHeader );
 
 	BlockHeader* block = static_cast<BlockHeader*> ( malloc ( block_size ) );
-	block->pool_index = 0;
+	block->owner.pool_index = 0;
+	block->owner.heap_slot  = static_cast<short> ( heap_slot );
+	block->owner.heap_generation = heap_generation;
 	return block + 1;
 }
 
+void* XEPL::HeapOfPools::Get_Line_Block ( size_t _size )
+{
+	long lines = ( static_cast<long> ( _size ) + Memory::cacheLine-1 ) / Memory::cacheLine;
+
+	if ( lines > Memory::linePools )
+		return Get_Block ( _size );
+
+	return pool_of_blocks[ SizeClasses::class_count + lines ]->Get_Or_Malloc();
+}
+
+void  XEPL::HeapOfPools::Recycle_Line_Block ( void* _ptr )
+{
+	if ( _ptr && SlabPage::Is_Slab_Block ( _ptr ) )
+	{
+		SlabPage* page = SlabPage::Page_Of ( _ptr );
+
+		if ( page->pool_index > SizeClasses::class_count
+			&& page->heap_slot.load ( std::memory_order_relaxed ) == heap_slot )
+		{
+			pool_of_blocks[page->pool_index]->Catch_Slab ( _ptr );
+			return;
+		}
+	}
+
+	Recycle_Block ( _ptr );
+}
+
 void  XEPL::HeapOfPools::Recycle_Block ( void* _ptr )
 {
 	if ( !_ptr )
 		return;
 
+	if ( SlabPage::Is_Slab_Block ( _ptr ) )
+	{
+		SlabPage* page = SlabPage::Page_Of ( _ptr );
+
+		if ( !page->pool_index )
+			return;
+
+		if ( page->heap_slot.load ( std::memory_order_relaxed ) == heap_slot )
+			pool_of_blocks[page->pool_index]->Catch_Slab ( _ptr );
+		else
+		{
+			++count_remote_frees;
+			Foreign_Slab ( _ptr, page );
+		}
+		return;
+	}
+
 	BlockHeader* returned_block = static_cast<BlockHeader*> ( _ptr )-1;
 
-	if ( returned_block->pool_index )
-		pool_of_blocks[returned_block->pool_index]->Catch_Or_Free ( returned_block );
+	if ( returned_block->owner.pool_index )
+	{
+		int owner_slot = returned_block->owner.heap_slot;
+
+		if ( owner_slot >= 0 && ( owner_slot != heap_slot || returned_block->owner.heap_generation != heap_generation ) )
+			Remote_Free ( returned_block );
+		else
+			pool_of_blocks[returned_block->owner.pool_index]->Catch_Or_Free ( returned_block );
+	}
 	else
 	{
 		++count_biggies_in;
@@ -323,949 +1004,2987 @@ void  XEPL::HeapOfPools::Recycle_Block ( void* _ptr )
 	}
 }
 
+void XEPL::HeapOfPools::Remote_Free ( BlockHeader* _block )
+{
+	++count_remote_frees;
 
-//    888888ba                    dP  .88888.  .8888b  888888ba  dP                   dP
-//    88    `8b                   88 d8'   `8b 88   "  88    `8b 88                   88
-//   a88aaaa8P' .d8888b. .d8888b. 88 88     88 88aaa  a88aaaa8P' 88 .d8888b. .d8888b. 88  .dP  .d8888b.
-//    88        88'  `88 88'  `88 88 88     88 88      88   `8b. 88 88'  `88 88'  `"" 88888"   Y8ooooo.
-//    88        88.  .88 88.  .88 88 Y8.   .8P 88      88    .88 88 88.  .88 88.  ... 88  `8b.       88
-//    dP        `88888P' `88888P' dP  `8888P'  dP      88888888P dP `88888P' `88888P' dP   `YP `88888P'
-//
+	if ( RemoteInbox::inbox_slots[_block->owner.heap_slot].Push_Owned ( _block ) )
+		return;
 
-XEPL::PoolOfBlocks::~PoolOfBlocks( void )
+	++count_orphaned;
+	RemoteInbox::orphan_blocks.Push_Block ( _block+1 );
+}
+
+void XEPL::HeapOfPools::Foreign_Slab ( void* _block, SlabPage* _page )
 {
-	total_mallocs  += blocks_malloced;
-	total_cached   += blocks_cached;
-	total_freed    += blocks_freed;
-	total_held     += blocks_holding;
+	int owner_slot = _page->heap_slot.load ( std::memory_order_acquire );
 
-	pool_mallocs  [ pool_index ] += blocks_malloced;
-	pool_cached   [ pool_index ] += blocks_cached;
-	pool_freed    [ pool_index ] += blocks_freed;
-	pool_held     [ pool_index ] += blocks_holding;
+	if ( owner_slot >= 0 && RemoteInbox::inbox_slots[owner_slot].Push_Block ( _block ) )
+		return;
 
-	while ( BlockHeader* block = head_block )
-	{
-		head_block=block->next_block;
-		free ( block );
-	}
+	_page->Orphan_Release();
 }
 
-XEPL::PoolOfBlocks::PoolOfBlocks ( long _index )
-	: head_block         ( nullptr )
-	, pool_index         ( _index )
-	, block_size         ( ( _index+1 )*Memory::poolWidth )
-	, blocks_malloced    ( 0 )
-	, blocks_cached      ( 0 )
-	, blocks_freed       ( 0 )
-	, blocks_holding     ( 0 )
-{}
-
-void XEPL::PoolOfBlocks::Catch_Or_Free ( BlockHeader* _block )
+void XEPL::HeapOfPools::Take_Returned ( void* _block )
 {
-	if ( blocks_holding > blocks_cached || blocks_holding > blocks_malloced )
+	if ( SlabPage::Is_Slab_Block ( _block ) )
 	{
-		++blocks_freed;
-		free ( _block );
+		SlabPage* page = SlabPage::Page_Of ( _block );
+
+		if ( page->heap_slot.load ( std::memory_order_relaxed ) == heap_slot )
+			pool_of_blocks[page->pool_index]->Catch_Slab ( _block );
+		else
+			Foreign_Slab ( _block, page );
+		return;
 	}
+
+	BlockHeader* block = static_cast<BlockHeader*> ( _block )-1;
+
+	if ( block->owner.heap_generation == heap_generation )
+		pool_of_blocks[block->owner.pool_index]->Catch_Returned ( block );
 	else
 	{
-		++blocks_holding;
-		_block->next_block = head_block;
-		head_block = _block;
+		++count_adopted;
+		pool_of_blocks[block->owner.pool_index]->Adopt_Block ( block );
 	}
 }
 
-void* XEPL::PoolOfBlocks::Get_Or_Malloc( void )
+void XEPL::HeapOfPools::Reclaim_Remote_Blocks ( void )
 {
-	BlockHeader* block = head_block;
-	if ( block )
-	{
-		--blocks_holding;
-		++blocks_cached;
-		head_block = block->next_block;
-	}
-	else
+	if ( heap_slot < 0 )
+		return;
+
+	void* block = RemoteInbox::inbox_slots[heap_slot].Take_Blocks ( false );
+
+	while ( block )
 	{
-		++blocks_malloced;
-		block = static_cast<BlockHeader*> ( malloc ( block_size ) );
+		void* next = *static_cast<void**> ( block );
+		++count_remote_reclaimed;
+		Take_Returned ( block );
+		block = next;
 	}
-	block->pool_index = pool_index;
 
-	return block+1;
+	if ( RemoteInbox::orphan_blocks.returned_blocks.load ( std::memory_order_relaxed ) )
+		Adopt_Orphans();
 }
 
-// required for operation
-std::atomic_size_t XEPL::pool_mallocs[] = {0};
-std::atomic_size_t XEPL::pool_cached[]  = {0};
-std::atomic_size_t XEPL::pool_freed[]   = {0};
-std::atomic_size_t XEPL::pool_held[]    = {0};
+void XEPL::HeapOfPools::Adopt_Orphans ( void )
+{
+	void* block = RemoteInbox::orphan_blocks.Take_Blocks ( false );
 
-// optional for observation
-std::atomic_size_t XEPL::total_mallocs     ( 0 );
-std::atomic_size_t XEPL::total_cached      ( 0 );
-std::atomic_size_t XEPL::total_freed       ( 0 );
-std::atomic_size_t XEPL::total_held        ( 0 );
-std::atomic_size_t XEPL::total_biggies_out ( 0 );
-std::atomic_size_t XEPL::total_biggies_in  ( 0 );
-std::atomic_size_t XEPL::largest_biggie    ( 0 );
+	while ( block )
+	{
+		void* next = *static_cast<void**> ( block );
+		BlockHeader* header = static_cast<BlockHeader*> ( block )-1;
+		++count_adopted;
+		pool_of_blocks[header->owner.pool_index]->Adopt_Block ( header );
+		block = next;
+	}
+}
 
+void* XEPL::HeapOfPools::Orphan_New ( size_t _size )
+{
+	++total_biggies_out;
 
-//    888888ba                                      dP                    a88888b.                              dP
-//    88    `8b                                     88                   d8'   `88                              88
-//   a88aaaa8P' .d8888b. .d8888b. dP    dP .d8888b. 88 .d8888b. 88d888b. 88        .d8888b. dP    dP 88d888b. d8888P .d8888b.
-//    88   `8b. 88ooood8 88'  `"" 88    88 88'  `"" 88 88ooood8 88'  `88 88        88'  `88 88    88 88'  `88   88   Y8ooooo.
-//    88     88 88.  ... 88.  ... 88.  .88 88.  ... 88 88.  ... 88       Y8.   .88 88.  .88 88.  .88 88    88   88         88
-//    dP     dP `88888P' `88888P' `8888P88 `88888P' dP `88888P' dP        Y88888P' `88888P' `88888P' dP    dP   dP   `88888P'
-//                                     .88
-//                                 d8888P
+	BlockHeader* block = static_cast<BlockHeader*> ( malloc ( _size + sizeof ( BlockHeader ) ) );
+	block->owner.pool_index = 0;
+	block->owner.heap_slot  = -1;
+	block->owner.heap_generation = 0;
+	return block + 1;
+}
 
-XEPL::RecycleCounts::~RecycleCounts()
+void XEPL::HeapOfPools::Orphan_Free ( void* _ptr )
 {
-	long biggies_out = total_biggies_out;
-	long biggies_in = total_biggies_in;
-
-	long leaking = total_mallocs - total_freed - total_held;
+	if ( !_ptr )
+		return;
 
-	if ( std_ostream && ( Show_Memory_Counts || leaking ) )
+	if ( SlabPage::Is_Slab_Block ( _ptr ) )
 	{
-		const long width = 13;
-
-		*std_ostream << "\nCounter:         Total : ";
-		for ( long index = 1; index <= Memory::maxPoolIndex; ++index )
-			*std_ostream << std::setw ( width ) << ( index+1 )*Memory::poolWidth << " ";
+		SlabPage* page = SlabPage::Page_Of ( _ptr );
 
-		Print_Pool_Counts ( std_ostream, "Mallocs: ", total_mallocs, pool_mallocs, width );
-		Print_Pool_Counts ( std_ostream, "Freed:   ", total_freed,   pool_freed,   width );
-		Print_Pool_Counts ( std_ostream, "Cached:  ", total_cached,  pool_cached,  width );
-		Print_Pool_Counts ( std_ostream, "Held:    ", total_held,    pool_held,    width );
-
-		String counts;
-		Long_Commafy ( biggies_out, &counts );
-		*std_ostream << "\nBiggies: " << std::setw( width ) << counts;
+		if ( page->pool_index )
+			Foreign_Slab ( _ptr, page );
+		return;
+	}
 
-		counts.assign(" :  Largest: " );
-		Long_In_Bytes ( largest_biggie, &counts );
+	BlockHeader* block = static_cast<BlockHeader*> ( _ptr )-1;
 
-		*std_ostream << counts << std::endl;
+	if ( !block->owner.pool_index )
+	{
+		++total_biggies_in;
+		free ( block );
+		return;
 	}
 
-	if ( leaking )
-		std::cerr << " ***LEAKING " << leaking << " Recycled Allocations: " << std::endl;
+	int owner_slot = block->owner.heap_slot;
 
-	if ( biggies_in-biggies_out )
-		std::cerr << " ***LEAKING " << biggies_in-biggies_out << " Biggie Allocations: " << std::endl;
-}
+	if ( owner_slot >= 0 && RemoteInbox::inbox_slots[owner_slot].Push_Owned ( block ) )
+		return;
 
-XEPL::RecycleCounts::RecycleCounts ( std::ostream* _ostream )
-	: std_ostream ( _ostream )
-{
-	total_mallocs     = 0;
-	total_cached      = 0;
-	total_freed       = 0;
-	total_held        = 0;
-	total_biggies_out = 0;
-	total_biggies_in  = 0;
-	largest_biggie    = 0;
+	++total_orphaned;
+	RemoteInbox::orphan_blocks.Push_Block ( _ptr );
 }
 
-void XEPL::PoolOfBlocks::Report( String* _into )
+void XEPL::HeapOfPools::Drain_Orphans ( void )
 {
-	_into->append( std::to_string(block_size)     ).append( ":(" );
-	_into->append( std::to_string(blocks_malloced)).append(",");
-	_into->append( std::to_string(blocks_freed)   ).append(",");
-	_into->append( std::to_string(blocks_cached)  ).append(",");
-	_into->append( std::to_string(blocks_holding) ).append(") ");;
+	void* block = RemoteInbox::orphan_blocks.Take_Blocks ( false );
+
+	while ( block )
+	{
+		void* next = *static_cast<void**> ( block );
+		BlockHeader* header = static_cast<BlockHeader*> ( block )-1;
+		++total_freed;
+		++pool_freed[header->owner.pool_index];
+		free ( header );
+		block = next;
+	}
 }
 
-void XEPL::HeapOfPools::Report(String* _into )
+long XEPL::HeapOfPools::Bytes_In_Use ( void )
 {
-	_into->append("[");
-	_into->append( std::to_string(largest_biggie_out) ).append( "," );
-	_into->append( std::to_string(count_biggies_out)  ).append( "/" );
-	_into->append( std::to_string(count_biggies_in)   ).append("] ");
+	long bytes = 0;
 
-	for ( long index = 1; index <= Memory::maxPoolIndex; ++index )
-		pool_of_blocks[index]->Report( _into );
+	for ( long index = 1; index <= pool_count; ++index )
+		bytes += pool_of_blocks[index]->Blocks_In_Use() * SizeClasses::class_bytes[index];
+
+	return std::max ( 0L, bytes );
 }
 
-void XEPL::Recycler::Report_Heap( String* _into )
+void XEPL::HeapOfPools::Prewarm_Slabs ( long _pages )
 {
-	tlsHeap->Report( _into );
+	if ( heap_slot < 0 || _pages < 0 )
+		return;
+
+	for ( long index = 1; index <= pool_count; ++index )
+	{
+		PoolOfBlocks* pool = pool_of_blocks[index];
+		pool->slab_mode = true;
+		pool->Add_Slab_Pages ( _pages );
+	}
 }
 
-void XEPL::RecycleCounts::Print_Pool_Counts ( std::ostream* _report, Text* _label, const std::atomic_size_t& _total, std::atomic_size_t* _array, int _width )
+void XEPL::HeapOfPools::Trim_Pools ( long _decay )
 {
-	long mega_sum = 0;
+	size_t trimmed = 0;
 
-	String counts;
-	*_report << "\n" << _label << std::setw ( _width ) << *Long_Commafy ( _total, &counts ) << " : ";
-
-	for ( long index = 1; index <= Memory::maxPoolIndex; ++index )
+	for ( long index = 1; index <= pool_count; ++index )
 	{
-		counts.clear();
-		*_report << std::setw ( _width ) << *Long_Commafy ( _array[index], &counts ) << " ";
+		PoolOfBlocks* pool = pool_of_blocks[index];
+		size_t        was  = pool->blocks_trimmed;
 
-		mega_sum += ( index+1 )*Memory::poolWidth * _array[index];
+		trimmed       += pool->Trim_Blocks ( _decay );
+		count_trimmed += pool->blocks_trimmed - was;
 	}
 
-	counts.clear();
-	*_report << std::setw ( _width+3 ) << *Long_In_Bytes ( mega_sum, &counts );
-}
+	if ( !trimmed )
+		return;
 
-//    a88888b.                              dP
-//   d8'   `88                              88
-//   88        .d8888b. dP    dP 88d888b. d8888P .d8888b. 88d888b. .d8888b.
-//   88        88'  `88 88    88 88'  `88   88   88ooood8 88'  `88 Y8ooooo.
-//   Y8.   .88 88.  .88 88.  .88 88    88   88   88.  ... 88             88
-//    Y88888P' `88888P' `88888P' dP    dP   dP   `88888P' dP       `88888P'
-//
+	++count_trims;
+	bytes_trimmed += trimmed;
 
-	/// per thread counter descriptions
-	const char* XEPL::Counters::Counter_Descriptions = "\
- genes:\
- traits:\
- lobes:\
- neurons:\
- dispatched:\
- rests:\
- actions:\
- wakes:\
- ";
+#ifdef __GLIBC__
+	static thread_local size_t untrimmed = 0;
+	if ( ( untrimmed += trimmed ) >= Memory::trimFloor )
+	{
+		malloc_trim ( 0 );
+		untrimmed = 0;
+	}
+#endif
+}
 
-void XEPL::Counters::Add ( Counters* _counters )
+XEPL::SlabPage* XEPL::HeapOfPools::New_Page ( void )
 {
-	long record_size = sizeof ( Counters );
-	long number_of_counters = record_size/sizeof ( long );
-	Counter* scounter = (Counter*) ( _counters );
-	Counter* tcounter = (Counter*) ( this );
+	HugeRegion* region = nullptr;
+	void*       memory = nullptr;
 
-	while ( number_of_counters-- )
-		*tcounter+++=*scounter++;
+	if ( page_policy == huge_pages )
+	{
+		if ( huge_region && huge_region->carve_next == huge_region->region_base + Memory::hugePageSize )
+		{
+			huge_region->Release_Region();
+			huge_region = nullptr;
+		}
+
+		if ( !huge_region )
+		{
+			huge_region = HugeRegion::Map_Region();
+
+			if ( huge_region )
+				++count_huge_regions;
+			else
+				page_policy = standard_pages;
+		}
+
+		if ( ( region = huge_region ) )
+		{
+			memory = region->carve_next;
+			region->carve_next += Memory::slabPageSize;
+			++region->region_refs;
+		}
+	}
+
+	if ( !memory )
+		memory = std::aligned_alloc ( Memory::slabPageSize, Memory::slabPageSize );
+
+	if ( !memory )
+		return nullptr;
+
+	SlabPage* page = new ( memory ) SlabPage();
+	page->huge_region = region;
+
+	++count_pages;
+	if ( region && region->huge_advised )
+		++count_huge_pages;
+
+	return page;
 }
 
-void XEPL::Counters::Report ( String* _string )
+size_t XEPL::HeapOfPools::Block_Bytes ( void* _block )
 {
-	String long_label ( Counter_Descriptions );
-	String lhs;
-	Counter* tcounter = (Counter*) ( this );
+	long pool_index = SlabPage::Is_Slab_Block ( _block )
+		? SlabPage::Page_Of ( _block )->pool_index
+		: ( static_cast<BlockHeader*> ( _block )-1 )->owner.pool_index;
 
-	_string->append( "" );
-	while ( Split_ch_lhs ( &long_label, ':', &lhs ) )
-	{
-		_string->append ( lhs ).append ( ": " );
-		_string->append ( std::to_string ( *tcounter ) ).append ( " " );
-		tcounter++;
-	}
+	return pool_index ? SizeClasses::class_bytes[pool_index] : 0;
 }
 
-void XEPL::Counters::Final_Report()
+void XEPL::HeapOfPools::Profile_New ( long _type_tag, void* _block )
 {
-	String long_label ( Counter_Descriptions );
-	String lhs;
-	Counter* tcounter = (Counter*) ( this );
+	ProfileCounts& counts = profile_counts[_type_tag];
 
-	String count;
+	++counts.allocs;
+	counts.live_bytes += Block_Bytes ( _block );
 
-	while ( Split_ch_lhs ( &long_label, ':', &lhs ) )
-	{
-		count.clear();
-		Long_Commafy ( *tcounter++, &count );
-		std::cout << std::setw ( 12 ) << lhs << std::setw ( 15 )
-		          << count << '\n';
-	}
+	if ( counts.peak_bytes < counts.live_bytes )
+		counts.peak_bytes = counts.live_bytes;
 
-	std::cout << std::flush;
+	if ( ++profile_ticks % Memory::profileEvery == 0 )
+		MemoryProfile::Sample_Site ( _type_tag );
 }
 
-//    .d888888    dP
-//   d8'    88    88
-//   88aaaaa88a d8888P .d8888b. 88d8b.d8b.
-//   88     88    88   88'  `88 88'`88'`88
-//   88     88    88   88.  .88 88  88  88
-//   88     88    dP   `88888P' dP  dP  dP
-//
+void XEPL::HeapOfPools::Profile_Delete ( long _type_tag, void* _block )
+{
+	ProfileCounts& counts = profile_counts[_type_tag];
 
-XEPL::Atom::~Atom( void )
-{}
+	++counts.frees;
+	counts.live_bytes -= Block_Bytes ( _block );
+}
 
-void  XEPL::Atom::Release( void )
+void XEPL::HeapOfPools::Profile_Into ( Gene* _gene )
 {
-	if ( --retain_count == 0 )
-		delete this;
-}
+	ProfileCounts snapshot[Memory::maxProfiled];
+	std::memcpy ( snapshot, profile_counts, sizeof ( snapshot ) );
 
+	String term;
+	for ( long tag = 0; tag < Memory::maxProfiled; ++tag )
+	{
+		ProfileCounts& counts = snapshot[tag];
+		if ( !counts.allocs )
+			continue;
 
-//    a88888b. dP                oo
-//   d8'   `88 88
-//   88        88d888b. .d8888b. dP 88d888b.
-//   88        88'  `88 88'  `88 88 88'  `88
-//   Y8.   .88 88    88 88.  .88 88 88    88
-//    Y88888P' dP    dP `88888P8 dP dP    dP
+		Gene* type_gene = _gene->Make_One ( MemoryProfile::type_names[tag].load() );
+
+		term.assign ( std::to_string ( counts.allocs ) );
+		type_gene->Trait_Set ( "allocs", &term );
+		term.assign ( std::to_string ( counts.frees ) );
+		type_gene->Trait_Set ( "frees", &term );
+		term.assign ( std::to_string ( counts.live_bytes ) );
+		type_gene->Trait_Set ( "live", &term );
+		term.assign ( std::to_string ( counts.peak_bytes ) );
+		type_gene->Trait_Set ( "peak", &term );
+	}
+}
+
+//    888888ba                               dP            dP            dP
+//    88    `8b                              88            88            88
+//   a88aaaa8P' .d8888b. 88d8b.d8b. .d8888b. d8888P .d8888b. 88 88d888b. 88d888b. .d8888b. dP.  .dP
+//    88   `8b. 88ooood8 88'`88'`88 88'  `88   88   88ooood8 88 88'  `88 88'  `88 88'  `88  `8bd8'
+//    88     88 88.  ... 88  88  88 88.  .88   88   88.  ... 88 88    88 88.  .88 88.  .88  .d88b.
+//    dP     dP `88888P' dP  dP  dP `88888P'   dP   `88888P' dP dP    dP 88Y8888' `88888P' dP'  `dP
 //
 
-XEPL::Chain::~Chain()
+XEPL::BlockHeader XEPL::RemoteInbox::closed_marker;
+XEPL::RemoteInbox XEPL::RemoteInbox::inbox_slots[Memory::maxHeaps];
+XEPL::RemoteInbox XEPL::RemoteInbox::orphan_blocks;
+
+int XEPL::RemoteInbox::Claim_Slot ( void )
 {
-	if ( head_bond )
+	for ( int slot = 0; slot < Memory::maxHeaps; ++slot )
 	{
-		MutexScope lock_chain ( chain_lock );
-
-		Bond* bond = head_bond;
-		while ( bond )
+		bool in_use = false;
+		if ( inbox_slots[slot].slot_in_use.compare_exchange_strong ( in_use, true ) )
 		{
-			Bond* next = bond->next_bond;
-			delete bond;
-			bond = next;
+			inbox_slots[slot].slot_generation.fetch_add ( 1, std::memory_order_acq_rel );
+			inbox_slots[slot].returned_blocks.store ( nullptr, std::memory_order_release );
+			return slot;
 		}
 	}
-
-	if ( is_my_lock )
-		delete chain_lock;
+	return -1;
 }
 
-XEPL::Chain::Chain ( bool _locked )
-	: chain_lock  ( nullptr )
-	, head_bond   ( nullptr )
-	, tail_bond   ( nullptr )
-	, is_my_lock  ( _locked )
+void XEPL::RemoteInbox::Release_Slot ( int _slot )
 {
-	if ( is_my_lock )
-		chain_lock = new Mutex();
+	inbox_slots[_slot].slot_in_use.store ( false, std::memory_order_release );
 }
 
-XEPL::Chain::Chain ( Atom* _atom )
-	: chain_lock ( nullptr )
-	, head_bond  ( new Bond ( _atom, nullptr ) )
-	, tail_bond  ( head_bond )
-	, is_my_lock ( false )
-{}
+bool XEPL::RemoteInbox::Any_In_Use ( void )
+{
+	for ( int slot = 0; slot < Memory::maxHeaps; ++slot )
+		if ( inbox_slots[slot].slot_in_use.load ( std::memory_order_acquire ) )
+			return true;
+	return false;
+}
 
-XEPL::Bond* XEPL::Chain::Add_Atom ( Atom* _atom )
+bool XEPL::RemoteInbox::Push_Block ( void* _block )
 {
-	MutexScope lock_chain ( chain_lock );
+	void* head = returned_blocks.load ( std::memory_order_relaxed );
+	do
+	{
+		if ( head == &closed_marker )
+			return false;
 
-	Bond* fresh_bond = new Bond ( _atom, tail_bond );
+		*static_cast<void**> ( _block ) = head;
+	}
+	while ( !returned_blocks.compare_exchange_weak ( head, _block, std::memory_order_release, std::memory_order_relaxed ) );
 
-	if ( !head_bond )
-		head_bond = fresh_bond;
-	else
-		tail_bond->next_bond = fresh_bond;
+	return true;
+}
 
-	tail_bond = fresh_bond;
+bool XEPL::RemoteInbox::Push_Owned ( BlockHeader* _block )
+{
+	if ( _block->owner.heap_generation != slot_generation.load ( std::memory_order_acquire ) )
+		return false;
 
-	return fresh_bond;
+	return Push_Block ( _block+1 );
 }
 
-bool XEPL::Chain::Pull_Atom ( Atom** _atom )
+void* XEPL::RemoteInbox::Take_Blocks ( bool _closing )
 {
-	MutexScope lock_chain ( chain_lock );
+	void* blocks = returned_blocks.exchange ( _closing ? &closed_marker : nullptr, std::memory_order_acquire );
 
-	if ( head_bond )
-	{
-		Bond* last_head = head_bond;
+	if ( blocks == &closed_marker )
+		return nullptr;
 
-		*_atom = head_bond->atom;
-		head_bond->atom = nullptr;
+	return blocks;
+}
 
-		head_bond = head_bond->next_bond;
+//   .d88888b  dP          dP       888888ba
+//   88.    "' 88          88       88    `8b
+//   `Y88888b. 88 .d8888b. 88d888b. a88aaaa8P' .d8888b. .d8888b. .d8888b.
+//         `8b 88 88'  `88 88'  `88 88        88'  `88 88'  `88 88ooood8
+//   d8'   .8P 88 88.  .88 88.  .88 88        88.  .88 88.  .88 88.  ...
+//    Y88888P  dP `88888P8 88Y8888' dP        `88888P8 `8888P88 `88888P'
+//                                                          .88
+//                                                      d8888P
 
-		delete last_head;
+static_assert ( alignof ( std::max_align_t ) >= 2*sizeof ( XEPL::BlockHeader ), "headered blocks must be told apart from slab blocks" );
+static_assert ( sizeof ( XEPL::SlabPage ) <= XEPL::Memory::slabHeader, "slab page header must fit in front of the first block" );
 
-		if ( head_bond )
-			head_bond->prev_bond = nullptr;
-		else
-			tail_bond = nullptr;
+bool XEPL::SlabPage::Is_Slab_Block ( void* _block )
+{
+	return !( reinterpret_cast<uintptr_t> ( _block ) & sizeof ( BlockHeader ) );
+}
 
-		return true;
-	}
+XEPL::SlabPage* XEPL::SlabPage::Page_Of ( void* _block )
+{
+	return reinterpret_cast<SlabPage*> ( reinterpret_cast<uintptr_t> ( _block ) & ~uintptr_t ( Memory::slabPageSize-1 ) );
+}
 
-	return false;
+void XEPL::SlabPage::Orphan_Release ( void )
+{
+	++total_freed;
+	++pool_freed[pool_index];
+
+	if ( orphan_blocks.fetch_sub ( 1 ) == 1 )
+	{
+		Free_Page();
+		++total_slab_pages_freed;
+	}
 }
 
-bool XEPL::Chain::Remove_Atom ( Atom* _atom )
+void XEPL::SlabPage::Free_Page ( void )
 {
-	MutexScope lock_chain ( chain_lock );
+	if ( HugeRegion* region = huge_region )
+		region->Release_Region();
+	else
+		free ( this );
+}
 
-	Bond* bond = head_bond;
+//   dP     dP                              888888ba                    oo
+//   88     88                              88    `8b
+//   88aaaaa88a dP    dP .d8888b. .d8888b. a88aaaa8P' .d8888b. .d8888b. dP .d8888b. 88d888b.
+//   88     88  88    88 88'  `88 88ooood8  88   `8b. 88ooood8 88'  `88 88 88'  `88 88'  `88
+//   88     88  88.  .88 88.  .88 88.  ...  88     88 88.  ... 88.  .88 88 88.  .88 88    88
+//   dP     dP  `88888P' `8888P88 `88888P'  dP     dP `88888P' `8888P88 dP `88888P' dP    dP
+//                            .88                                   .88
+//                        d8888P                                d8888P
 
-	while ( bond && bond->atom != _atom )
-		bond=bond->next_bond;
+XEPL::HugeRegion* XEPL::HugeRegion::Map_Region ( void )
+{
+#ifdef __linux__
+	const size_t span = 2*Memory::hugePageSize;
 
-	if ( !bond )
-		return !!head_bond;
+	void* mapped = mmap ( nullptr, span, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0 );
+	if ( mapped == MAP_FAILED )
+		return nullptr;
 
-	if ( bond == head_bond )
-		head_bond = bond->next_bond;
-	else
-		bond->prev_bond->next_bond = bond->next_bond;
+	char* start = static_cast<char*> ( mapped );
+	char* base  = reinterpret_cast<char*> ( ( reinterpret_cast<uintptr_t> ( start ) + Memory::hugePageSize-1 ) & ~uintptr_t ( Memory::hugePageSize-1 ) );
 
-	if ( bond == tail_bond )
-		tail_bond = bond->prev_bond;
-	else
-		bond->next_bond->prev_bond = bond->prev_bond;
+	if ( base > start )
+		munmap ( start, base-start );
 
-	delete bond;
+	if ( base + Memory::hugePageSize < start + span )
+		munmap ( base + Memory::hugePageSize, start + span - base - Memory::hugePageSize );
 
-	return !head_bond;
+	HugeRegion* region = new ( malloc ( sizeof ( HugeRegion ) ) ) HugeRegion();
+	region->region_base  = base;
+	region->carve_next   = base;
+	region->region_refs  = 1;
+#ifdef MADV_HUGEPAGE
+	region->huge_advised = !madvise ( base, Memory::hugePageSize, MADV_HUGEPAGE );
+#endif
+	++total_huge_regions;
+
+	return region;
+#else
+	return nullptr;
+#endif
 }
 
-void XEPL::Chain::Remove_Bond ( Bond* _bond )
+void XEPL::HugeRegion::Release_Region ( void )
 {
-	MutexScope lock_chain ( chain_lock );
-
-	if ( _bond->prev_bond )
-		_bond->prev_bond->next_bond = _bond->next_bond;
-	else
-		head_bond = _bond->next_bond;
-
-	if ( _bond->next_bond )
-		_bond->next_bond->prev_bond = _bond->prev_bond;
-	else
-		tail_bond = _bond->prev_bond;
+	if ( region_refs.fetch_sub ( 1 ) != 1 )
+		return;
 
-	delete _bond;
+#ifdef __linux__
+	munmap ( region_base, Memory::hugePageSize );
+#endif
+	free ( this );
+	++total_huge_regions_freed;
 }
 
 
-//    a88888b.          dP dP
-//   d8'   `88          88 88
-//   88        .d8888b. 88 88
-//   88        88ooood8 88 88
-//   Y8.   .88 88.  ... 88 88
-//    Y88888P' `88888P' dP dP
-//
+//   .d88888b                               dP            dP        .d888888
+//   88.    "'                              88            88       d8'    88
+//   `Y88888b. .d8888b. 88d888b. .d8888b. d8888P .d8888b. 88d888b. 88aaaaa88a 88d888b. .d8888b. 88d888b. .d8888b.
+//         `8b 88'  `"" 88'  `88 88'  `88   88   88'  `"" 88'  `88 88     88  88'  `88 88ooood8 88'  `88 88'  `88
+//   d8'   .8P 88.  ... 88       88.  .88   88   88.  ... 88    88 88     88  88       88.  ... 88    88 88.  .88
+//    Y88888P  `88888P' dP       `88888P8   dP   `88888P' dP    dP 88     88  dP       `88888P' dP    dP `88888P8
 
-XEPL::Cell::~Cell()
+thread_local XEPL::ScratchArena* XEPL::tlsScratch = nullptr;
+
+XEPL::ScratchArena::~ScratchArena()
 {
-	delete cell_name;
+	total_scratch_blocks += blocks_bumped;
+
+	while ( SlabPage* page = first_page )
+	{
+		first_page = page->next_page;
+		page->Free_Page();
+		++total_scratch_pages_freed;
+	}
 }
 
-XEPL::Cell::Cell ( Cord* _cord )
-	: Atom()
-	, cell_name ( new Cord ( _cord ) )
+XEPL::ScratchArena::ScratchArena()
+	: first_page    ( nullptr )
+	, bump_page     ( nullptr )
+	, bump_next     ( nullptr )
+	, bump_limit    ( nullptr )
+	, page_count    ( 0 )
+	, blocks_bumped ( 0 )
 {}
 
-XEPL::Cell::Cell ( Text* _chars )
-	: Atom()
-	, cell_name ( new Cord ( _chars ) )
-{}
+bool XEPL::ScratchArena::Next_Page ( void )
+{
+	SlabPage* page = bump_page ? bump_page->next_page : first_page;
 
-//    a88888b.                     dP
-//   d8'   `88                     88
-//   88        .d8888b. 88d888b. d8888P .d8888b. dP.  .dP
-//   88        88'  `88 88'  `88   88   88ooood8  `8bd8'
-//   Y8.   .88 88.  .88 88         88   88.  ...  .d88b.
-//    Y88888P' `88888P' dP         dP   `88888P' dP'  `dP
-//
+	if ( !page )
+	{
+		if ( page_count >= Memory::scratchPages )
+			return false;
 
-XEPL::Cortex* XEPL::cortex = nullptr;
+		HeapOfPools* heap = tlsHeap;
+		if ( !heap || !( page = heap->New_Page() ) )
+			return false;
 
-void XEPL::Cortex::Close_Cortex( void )
-{
-	if( !host_lobe->index_link )
-		return;
+		page->pool_index = 0;
+		page->heap_slot.store ( -1, std::memory_order_relaxed );
+		page->next_page  = nullptr;
 
-	host_lobe->Lobe_Dying();
-	host_lobe->index_link->Release();
-	host_lobe->indicies.Unstack( host_lobe );
-	host_lobe->index_link = nullptr;
+		if ( bump_page )
+			bump_page->next_page = page;
+		else
+			first_page = page;
+
+		++page_count;
+		++total_scratch_pages;
+	}
+
+	bump_page  = page;
+	bump_next  = reinterpret_cast<char*> ( page ) + Memory::slabHeader;
+	bump_limit = reinterpret_cast<char*> ( page ) + Memory::slabPageSize;
+
+	return true;
 }
 
-XEPL::Cortex::~Cortex()
+void* XEPL::ScratchArena::Get_Block ( size_t _size )
 {
-	Close_Cortex();
+	const long bytes = static_cast<long> ( ( _size + Memory::poolWidth-1 ) & ~size_t ( Memory::poolWidth-1 ) );
 
-	host_lobe->Release();
-	host_lobe = nullptr;
-	tlsLobe   = nullptr;
-	
-	delete keywords_map;
-	delete operators_map;
-	delete render_map;
-	delete mutual_map;
-	delete commands_map;
+	if ( bytes > Memory::slabPageSize - Memory::slabHeader )
+		return nullptr;
 
-	cortex  = nullptr;
+	while ( bump_limit - bump_next < bytes )
+		if ( !Next_Page() )
+			return nullptr;
 
-	if ( Show_Counters )
-		final_counters.Final_Report();
+	void* block = bump_next;
+	bump_next += bytes;
+	++blocks_bumped;
+
+	return block;
 }
 
-XEPL::Cortex::Cortex ( Text* _name, std::ostream& _ostream )
-	: memory_counts    ( &_ostream )
-	, recycle_counts   ( &_ostream )
-	, memory_backpack  ()
-	, keywords_map     ( new KeywordsMap()  )
-	, operators_map    ( new OperatorsMap() )
-	, commands_map     ( new CommandsMap()  )
-	, mutual_map       ( new MutualsMap()   )
-	, render_map       ( new RenderMap()    )
-	, host_lobe        ( tlsLobe = new Lobe ( _name ) )
-	, short_term_memories()
-	, final_counters   ()
+void XEPL::ScratchArena::Reset ( void )
 {
-	
-	cortex  = this;
-
-	Set_Thread_Name ( host_lobe->cpp_thread, _name );
-
-	host_lobe->Attach();
-	host_lobe->indicies.Stack(host_lobe, new Gene ( nullptr, "Index", host_lobe->cell_name ));
-	host_lobe->Lobe_Born();
+	bump_page  = nullptr;
+	bump_next  = nullptr;
+	bump_limit = nullptr;
 }
 
-void XEPL::Cortex::Register_Command ( Text* _chars, Command _command )
+void XEPL::ScratchArena::Report ( String* _into )
 {
-	if ( !_chars )
-		return;
+	_into->append("<");
+	_into->append( std::to_string(blocks_bumped) ).append( "," );
+	_into->append( std::to_string(page_count)    ).append("> ");
+}
 
-	String name_cord ( _chars );
+//   8888ba.88ba                                      oo                   888888ba                               dP
+//   88  `8b  `8b                                                          88    `8b                              88
+//   88   88   88 .d8888b. .d8888b. .d8888b. d888888b dP 88d888b. .d8888b. 88     88 .d8888b. 88d888b. .d8888b. d8888P
+//   88   88   88 88'  `88 88'  `88 88'  `88    .d8P' 88 88'  `88 88ooood8 88     88 88ooood8 88'  `88 88'  `88   88
+//   88   88   88 88.  .88 88.  .88 88.  .88  .Y8P    88 88    88 88.  ... 88    .8P 88.  ... 88.  .88 88.  .88   88
+//   dP   dP   dP `88888P8 `8888P88 `88888P8 d888888P dP dP    dP `88888P' 8888888P  `88888P' 88Y888P' `88888P'   dP
+//                              .88                                                           88
+//                          d8888P                                                            dP
 
-	auto [it, noob] = commands_map->insert_or_assign ( name_cord, _command );
+XEPL::MagazineDepot XEPL::MagazineDepot::depot_shelves[Memory::maxPoolSlot+1];
 
-	if (!noob)
-		ErrorReport error_report("Replaced command: ", &name_cord );
+bool XEPL::MagazineDepot::Push_Magazine ( BlockHeader* _magazine )
+{
+	std::lock_guard<std::mutex> lock_shelf ( shelf_lock );
 
-	TRACE( "New_Command", nullptr, &name_cord);
-}
+	if ( magazine_count >= Memory::depotShelf )
+		return false;
 
-bool XEPL::Cortex::Did_Command ( Text* _chars )
+	*reinterpret_cast<BlockHeader**> ( _magazine+1 ) = magazines;
+	magazines = _magazine;
+	++magazine_count;
+
+	return true;
+}
+
+XEPL::BlockHeader* XEPL::MagazineDepot::Pull_Magazine ( void )
 {
-	if ( !_chars || !*_chars )
-		return false;
+	if ( !magazine_count.load ( std::memory_order_relaxed ) )
+		return nullptr;
+
+	std::lock_guard<std::mutex> lock_shelf ( shelf_lock );
+
+	BlockHeader* magazine = magazines;
+	if ( magazine )
+	{
+		magazines = *reinterpret_cast<BlockHeader**> ( magazine+1 );
+		--magazine_count;
+	}
+
+	return magazine;
+}
 
-	String command_name ( _chars );
+void XEPL::MagazineDepot::Drain_Shelves ( void )
+{
+	for ( long index = 1; index <= Memory::maxPoolSlot; ++index )
 	{
-		String cmd;
-		String opt;
+		MagazineDepot& shelf = depot_shelves[index];
 
-		Split_ch_lhs_rhs ( &command_name, ' ', &cmd, &opt );
+		std::lock_guard<std::mutex> lock_shelf ( shelf.shelf_lock );
 
-		auto it  = commands_map->find ( cmd );
-		if ( it != commands_map->end() )
+		while ( BlockHeader* magazine = shelf.magazines )
 		{
-			( *it->second ) ( &opt );
-			return true;
+			shelf.magazines = *reinterpret_cast<BlockHeader**> ( magazine+1 );
+			--shelf.magazine_count;
+			++total_depot_drained;
+
+			while ( BlockHeader* block = magazine )
+			{
+				magazine = block->next_block;
+				free ( block );
+				++total_freed;
+				++pool_freed[index];
+			}
 		}
 	}
+}
 
-	if ( tlsLobe->Performed_Method ( &command_name, nullptr ) )
-		return true;
+//   8888ba.88ba                                                  888888ba                    .8888b oo dP
+//   88  `8b  `8b                                                 88    `8b                   88   "    88
+//   88   88   88 .d8888b. 88d8b.d8b. .d8888b. 88d888b. dP    dP a88aaaa8P' 88d888b. .d8888b. 88aaa  dP 88 .d8888b.
+//   88   88   88 88ooood8 88'`88'`88 88'  `88 88'  `88 88    88  88        88'  `88 88'  `88 88     88 88 88ooood8
+//   88   88   88 88.  ... 88  88  88 88.  .88 88       88.  .88  88        88       88.  .88 88     88 88 88.  ...
+//   dP   dP   dP `88888P' dP  dP  dP `88888P' dP       `8888P88  dP        dP       `88888P' dP     dP dP `88888P'
+//                                                           .88
+//                                                       d8888P
 
-	ErrorReport error_report( "Command not understood: ", _chars );
-	return false;
-}
+std::atomic_long                    XEPL::MemoryProfile::type_count ( 1 );
+std::atomic<XEPL::Text*>            XEPL::MemoryProfile::type_names  [ Memory::maxProfiled ] = { {"Untagged"} };
+XEPL::ProfileCounts                 XEPL::MemoryProfile::type_totals [ Memory::maxProfiled ] = {};
+XEPL::MemoryProfile::ProfileSite    XEPL::MemoryProfile::sample_sites[ Memory::profileSites ] = {};
+std::mutex                          XEPL::MemoryProfile::profile_lock;
 
-bool XEPL::Cortex::Did_Dot_Tag ( Nucleus* _nucleus, Gene* _call_gene )
+long XEPL::MemoryProfile::Register_Type ( Text* _mangled )
 {
-	String  neuron_name;
-	String  method_name;
-	Neuron* target_neuron = nullptr;
+	static char name_pool[ Memory::maxProfiled ][ 64 ];
 
-	Split_ch_lhs_rhs ( _call_gene->cell_name, '.', &neuron_name, &method_name );
+	long tag = type_count++;
+	if ( tag >= Memory::maxProfiled )
+		return 0;
 
-	if ( _nucleus->Host()->Find_Neuron ( &neuron_name, &target_neuron ) )
-		return target_neuron->Performed_Method ( &method_name, _call_gene );
+	Text* readable = _mangled;
+#ifdef __GNUG__
+	int status = 0;
+	char* demangled = abi::__cxa_demangle ( _mangled, nullptr, nullptr, &status );
+	if ( demangled )
+		readable = demangled;
+#endif
 
-	return false;
+	static Text* noise_words[] = { "XEPL", "std", "__cxx11", "__detail", "TAllocatorT", "_Rb_tree_node", "_Hash_node", "pair", "const", "false", "true", nullptr };
+
+	char*  name   = name_pool[tag];
+	size_t length = 0;
+
+	if ( !std::strncmp ( readable, "XEPL::TAllocatorT", 17 ) )
+		length = std::strlen ( std::strcpy ( name, "Alloc" ) );
+
+	for ( Text* scan = readable; *scan; )
+	{
+		if ( !std::isalnum ( static_cast<unsigned char> ( *scan ) ) && *scan != '_' )
+		{
+			++scan;
+			continue;
+		}
+
+		Text* word = scan;
+		while ( std::isalnum ( static_cast<unsigned char> ( *scan ) ) || *scan == '_' )
+			++scan;
+
+		size_t word_length = scan-word;
+		bool   noise = false;
+
+		for ( Text** noise_word = noise_words; *noise_word && !noise; ++noise_word )
+			noise = std::strlen ( *noise_word ) == word_length && !std::strncmp ( *noise_word, word, word_length );
+
+		if ( noise || length + word_length + 2 > sizeof ( name_pool[0] ) )
+			continue;
+
+		if ( length )
+			name[length++] = '_';
+
+		std::memcpy ( name+length, word, word_length );
+		length += word_length;
+	}
+
+	name[length] = '\0';
+
+#ifdef __GNUG__
+	free ( demangled );
+#endif
+
+	type_names[tag].store ( name );
+
+	return tag;
 }
 
-void XEPL::Cortex::Register_Keyword ( Text* _chars, Keyword _keyword )
+void XEPL::MemoryProfile::Sample_Site ( long _type_tag )
 {
-	if (!_chars)
+#ifdef __GLIBC__
+	void* frames[ Memory::profileDepth+2 ];
+	int depth = backtrace ( frames, Memory::profileDepth+2 ) - 2;
+	if ( depth <= 0 )
 		return;
 
-	Cord name_cord(_chars);
+	std::lock_guard<std::mutex> lock_sites ( profile_lock );
 
-	auto [it, noob] = keywords_map->insert_or_assign(name_cord, _keyword);
+	for ( ProfileSite& site : sample_sites )
+	{
+		if ( !site.hits )
+		{
+			site.type_tag = _type_tag;
+			site.depth    = depth;
+			std::memcpy ( site.frames, frames+2, depth * sizeof ( void* ) );
+		}
+		else if ( site.type_tag != _type_tag || site.depth != depth
+			|| std::memcmp ( site.frames, frames+2, depth * sizeof ( void* ) ) )
+			continue;
 
-	if (!noob)
-		ErrorReport error_report("Replaced keyword: ", &name_cord);
+		++site.hits;
+		return;
+	}
+#else
+	( void ) _type_tag;
+#endif
+}
+
+void XEPL::MemoryProfile::Fold_Counts ( ProfileCounts* _counts )
+{
+	std::lock_guard<std::mutex> lock_totals ( profile_lock );
 
-	TRACE( "New_Keyword", nullptr, &name_cord);
+	for ( long tag = 0; tag < Memory::maxProfiled; ++tag )
+	{
+		ProfileCounts& total = type_totals[tag];
+		total.allocs     += _counts[tag].allocs;
+		total.frees      += _counts[tag].frees;
+		total.live_bytes += _counts[tag].live_bytes;
+		total.peak_bytes  = std::max ( total.peak_bytes, _counts[tag].peak_bytes );
+	}
 }
 
-bool XEPL::Cortex::Did_Keyword ( Nucleus* _nucleus, Gene* _call_gene )
+void XEPL::MemoryProfile::Reset_Profile ( void )
 {
-	auto it  = keywords_map->find ( *_call_gene->cell_name );
-	if ( it == keywords_map->end() )
-		return false;
+	std::lock_guard<std::mutex> lock_totals ( profile_lock );
 
-	auto host = _nucleus->Host();
+	std::memset ( type_totals,  0, sizeof ( type_totals ) );
+	std::memset ( sample_sites, 0, sizeof ( sample_sites ) );
+}
 
-	String param;
-	String* param_string = &param;
+void XEPL::MemoryProfile::Print_Profile ( std::ostream* _report )
+{
+	std::lock_guard<std::mutex> lock_totals ( profile_lock );
 
-	XEPL::String content;
-	if ( _call_gene->Copy_Content(&content) )
+	*_report << "\nProfile:                     Allocs        Frees         Live    Heap Peak";
+
+	for ( long tag = 0; tag < Memory::maxProfiled; ++tag )
 	{
-		if ( *content.c_str() == '{' )
-			Script ( host, _call_gene, &param );
-		else
-			param_string = &content;
+		ProfileCounts& total = type_totals[tag];
+		if ( !total.allocs )
+			continue;
+
+		*_report << "\n" << std::setw ( 24 ) << std::left << type_names[tag].load() << std::right
+			<< std::setw ( 13 ) << total.allocs
+			<< std::setw ( 13 ) << total.frees
+			<< std::setw ( 13 ) << total.live_bytes
+			<< std::setw ( 13 ) << total.peak_bytes;
 	}
 
-	if ( Show_Trace )
+	ProfileSite* ranked[ Memory::profileSites ];
+	long sites = 0;
+
+	for ( ProfileSite& site : sample_sites )
+		if ( site.hits )
+			ranked[sites++] = &site;
+
+	std::sort ( ranked, ranked+sites, [] ( ProfileSite* _lhs, ProfileSite* _rhs ) { return _lhs->hits > _rhs->hits; } );
+
+	for ( long rank = 0; rank < sites && rank < 10; ++rank )
 	{
-		String trace_string;
-		_call_gene->Print_Into(&trace_string, 1);
-		TRACE( "DO_Keyword", _nucleus->Host(), &trace_string, param_string );
+		ProfileSite* site = ranked[rank];
+
+		*_report << "\nSampled " << site->hits << "x " << type_names[site->type_tag].load();
+#ifdef __GLIBC__
+		if ( char** symbols = backtrace_symbols ( site->frames, site->depth ) )
+		{
+			for ( int frame = 0; frame < site->depth; ++frame )
+				*_report << "\n    " << symbols[frame];
+			free ( symbols );
+		}
+#endif
 	}
 
-	it->second ( _nucleus->Host(), _call_gene, param_string );
+	*_report << std::endl;
+}
 
-	return true;
+//   .d88888b  oo                    a88888b. dP
+//   88.    "'                      d8'   `88 88
+//   `Y88888b. dP d888888b .d8888b. 88        88 .d8888b. .d8888b. .d8888b. .d8888b. .d8888b.
+//         `8b 88    .d8P' 88ooood8 88        88 88'  `88 Y8ooooo. Y8ooooo. 88ooood8 Y8ooooo.
+//   d8'   .8P 88  .Y8P    88.  ... Y8.   .88 88 88.  .88       88       88 88.  ...       88
+//    Y88888P  dP d888888P `88888P'  Y88888P' dP `88888P8 `88888P' `88888P' `88888P' `88888P'
+//
+
+long          XEPL::SizeClasses::class_count  = 0;
+long          XEPL::SizeClasses::pool_count   = 0;
+long          XEPL::SizeClasses::pooled_limit = 0;
+long          XEPL::SizeClasses::class_bytes  [ Memory::maxPoolSlot+1 ] = {0};
+unsigned char XEPL::SizeClasses::class_lookup [ Memory::maxPooled/Memory::poolWidth+1 ] = {0};
+
+static XEPL::SizeClasses default_size_classes ( XEPL::Memory::linearLimit, XEPL::Memory::pooledLimit );
+
+XEPL::SizeClasses::SizeClasses ( long _linear_limit, long _pooled_limit )
+{
+	Configure ( _linear_limit, _pooled_limit );
 }
 
-XEPL::Gene* XEPL::Cortex::Locate_Gene ( Nucleus* _nucleus, Cord* _gene_name )
+void XEPL::SizeClasses::Configure ( long _linear_limit, long _pooled_limit )
 {
-	if ( auto ephemerals = tlsLobe->ephemerals )
+	_pooled_limit = std::clamp ( _pooled_limit, Memory::poolWidth, Memory::maxPooled );
+	_linear_limit = std::clamp ( _linear_limit, Memory::poolWidth, _pooled_limit );
+
+	long sizes[Memory::maxPoolIndex+1] = {0};
+	long count = 0;
+	long bytes = Memory::poolWidth;
+
+	while ( bytes <= _linear_limit && count < Memory::maxPoolIndex )
 	{
-		auto it  = ephemerals->find ( *_gene_name );
-		if ( it != ephemerals->end() )
-			return it->second;
+		sizes[++count] = bytes;
+		bytes += Memory::poolWidth;
 	}
 
-	Nucleus* current_nucleus = _nucleus;
-	Gene*    located_gene    = nullptr;
-	Gene*    vitals          = nullptr;
+	bytes = sizes[count];
 
-	while ( current_nucleus )
+	while ( count < Memory::maxPoolIndex )
 	{
-		if ( current_nucleus->observer->Get_First_Gene("Vitals", &vitals ) )
-			if ( vitals->inner_genes && ( vitals->Get_First_Gene ( _gene_name, &located_gene ) ) )
-				return located_gene;
+		long group = Memory::poolWidth;
+		while ( group*2 <= bytes )
+			group *= 2;
 
-		current_nucleus = current_nucleus->parent_neuron;
+		bytes += std::max ( Memory::poolWidth, group/4/Memory::poolWidth*Memory::poolWidth );
+		if ( bytes > _pooled_limit )
+			break;
+
+		sizes[++count] = bytes;
 	}
 
-	auto it  = cortex->mutual_map->find ( *_gene_name );
-	if ( it != cortex->mutual_map->end() )
-		return it->second ( _nucleus );
+	if ( count == class_count && std::equal ( sizes+1, sizes+count+1, class_bytes+1 ) )
+		return;
 
-	return nullptr;
+	if ( RemoteInbox::Any_In_Use() )
+	{
+		ErrorReport error_report ( "Size classes can't change while heaps are active" );
+		return;
+	}
+
+	MagazineDepot::Drain_Shelves();
+	HeapOfPools::Drain_Orphans();
+
+	std::copy ( sizes, sizes+count+1, class_bytes );
+	class_count  = count;
+	pool_count   = count + Memory::linePools;
+
+	for ( long line = 1; line <= Memory::linePools; ++line )
+		class_bytes[count+line] = line*Memory::cacheLine;
+	pooled_limit = class_bytes[count];
+
+	long index = 1;
+	for ( long slot = 0; slot*Memory::poolWidth <= pooled_limit; ++slot )
+	{
+		while ( class_bytes[index] < slot*Memory::poolWidth )
+			++index;
+		class_lookup[slot] = static_cast<unsigned char> ( index );
+	}
 }
 
-XEPL::Neuron* XEPL::Cortex::Locate_Neuron ( Nucleus* _nucleus, Cord* _cord, char _split_char )
+
+//    888888ba                    dP  .88888.  .8888b  888888ba  dP                   dP
+//    88    `8b                   88 d8'   `8b 88   "  88    `8b 88                   88
+//   a88aaaa8P' .d8888b. .d8888b. 88 88     88 88aaa  a88aaaa8P' 88 .d8888b. .d8888b. 88  .dP  .d8888b.
+//    88        88'  `88 88'  `88 88 88     88 88      88   `8b. 88 88'  `88 88'  `"" 88888"   Y8ooooo.
+//    88        88.  .88 88.  .88 88 Y8.   .8P 88      88    .88 88 88.  .88 88.  ... 88  `8b.       88
+//    dP        `88888P' `88888P' dP  `8888P'  dP      88888888P dP `88888P' `88888P' dP   `YP `88888P'
+//
+
+XEPL::PoolOfBlocks::~PoolOfBlocks( void )
 {
-	Neuron* neuron = nullptr;
+	Release_Slabs();
 
-	size_t spot = _cord->find ( _split_char );
-	if ( spot  == _cord->npos )
+	while ( head_count >= Memory::magazineSize && Push_Magazine() )
+	{}
+
+	total_mallocs  += blocks_malloced;
+	total_cached   += blocks_cached;
+	total_freed    += blocks_freed;
+	total_held     += blocks_holding;
+
+	pool_mallocs  [ pool_index ] += blocks_malloced;
+	pool_cached   [ pool_index ] += blocks_cached;
+	pool_freed    [ pool_index ] += blocks_freed;
+	pool_held     [ pool_index ] += blocks_holding;
+
+	while ( BlockHeader* block = head_block )
 	{
-		_nucleus->Host()->Find_Neuron ( _cord, &neuron );
-		return neuron;
+		head_block=block->next_block;
+		free ( block );
 	}
+}
 
-	Cord* remaining_path = _cord;
-	String neuron_name;
-	String neuron_root;
+XEPL::PoolOfBlocks::PoolOfBlocks ( HeapOfPools* _heap, long _index, int _slot, int _generation )
+	: owner_heap         ( _heap )
+	, head_block         ( nullptr )
+	, free_slab          ( nullptr )
+	, slab_pages         ( nullptr )
+	, fresh_pages        ( nullptr )
+	, carve_next         ( nullptr )
+	, carve_limit        ( nullptr )
+	, pool_index         ( _index )
+	, heap_slot          ( _slot )
+	, heap_generation    ( _generation )
+	, block_size         ( SizeClasses::class_bytes[_index] )
+	, high_water         ( std::max ( 2*Memory::magazineSize, Memory::highWater/static_cast<long> ( block_size ) ) )
+	, slab_mode          ( false )
+	, blocks_malloced    ( 0 )
+	, blocks_cached      ( 0 )
+	, blocks_freed       ( 0 )
+	, blocks_holding     ( 0 )
+	, slab_page_count    ( 0 )
+	, head_count         ( 0 )
+	, blocks_pushed      ( 0 )
+	, blocks_pulled      ( 0 )
+	, trim_mark          ( 0 )
+	, demand_average     ( 0 )
+	, blocks_trimmed     ( 0 )
+{}
 
-	neuron = cortex->host_lobe;
-	
-	while ( neuron && Split_ch_lhs_rhs ( remaining_path, _split_char, &neuron_root, &neuron_name ) )
+size_t XEPL::PoolOfBlocks::Blocks_Owned ( void )
+{
+	return blocks_malloced + blocks_pulled - blocks_pushed;
+}
+
+long XEPL::PoolOfBlocks::Blocks_In_Use ( void )
+{
+	return static_cast<long> ( Blocks_Owned() - blocks_freed - blocks_holding );
+}
+
+void XEPL::PoolOfBlocks::Catch_Block ( BlockHeader* _block )
+{
+	++blocks_holding;
+	++head_count;
+	_block->next_block = head_block;
+	head_block = _block;
+
+	if ( head_count >= high_water )
+		Push_Magazine();
+}
+
+void XEPL::PoolOfBlocks::Adopt_Block ( BlockHeader* _block )
+{
+	if ( head_count >= high_water )
 	{
-		if ( !neuron->Find_Neuron ( &neuron_root, &neuron ) )
-			break;
-		remaining_path = &neuron_name;
+		++blocks_freed;
+		free ( _block );
+		return;
 	}
 
-	if ( neuron )
-		neuron->Find_Neuron ( &neuron_name, &neuron );
+	++blocks_pulled;
+	Catch_Block ( _block );
+}
 
-	return neuron;
+void XEPL::PoolOfBlocks::Catch_Or_Free ( BlockHeader* _block )
+{
+	if ( blocks_holding > blocks_cached || blocks_holding > Blocks_Owned() )
+	{
+		++blocks_freed;
+		free ( _block );
+	}
+	else
+		Catch_Block ( _block );
 }
 
-XEPL::Axon* XEPL::Cortex::Locate_Axon ( Nucleus* _nucleus, Cord* _cord, char _split_char )
+void XEPL::PoolOfBlocks::Catch_Returned ( BlockHeader* _block )
 {
-	if ( !_cord )
-		return nullptr;
+	if ( blocks_holding >= Blocks_Owned() )
+	{
+		++blocks_freed;
+		free ( _block );
+	}
+	else
+		Catch_Block ( _block );
+}
 
-	Axon* located_axon = nullptr;
+size_t XEPL::PoolOfBlocks::Trim_Blocks ( long _decay )
+{
+	size_t demand = blocks_cached + blocks_malloced - trim_mark;
+	trim_mark    += demand;
 
-	String  axon_name;
-	String  path_string;
+	demand_average = ( demand_average * ( _decay-1 ) + demand ) / _decay;
+
+	size_t keep = std::max ( 2*demand_average, static_cast<size_t> ( Memory::magazineSize ) );
+	size_t bytes = 0;
+
+	while ( head_count > keep )
+	{
+		BlockHeader* block = head_block;
+		head_block = block->next_block;
+		free ( block );
+
+		--head_count;
+		--blocks_holding;
+		++blocks_freed;
+		++blocks_trimmed;
+		bytes += block_size + sizeof ( BlockHeader );
+	}
+
+	return bytes;
+}
+
+bool XEPL::PoolOfBlocks::Push_Magazine ( void )
+{
+	BlockHeader* magazine = head_block;
+	BlockHeader* last     = magazine;
+
+	for ( long count = 1; count < Memory::magazineSize; ++count )
+		last = last->next_block;
+
+	BlockHeader* remaining = last->next_block;
+	last->next_block = nullptr;
+
+	if ( !MagazineDepot::depot_shelves[pool_index].Push_Magazine ( magazine ) )
+	{
+		last->next_block = remaining;
+		return false;
+	}
+
+	head_block      = remaining;
+	head_count     -= Memory::magazineSize;
+	blocks_holding -= Memory::magazineSize;
+	blocks_pushed  += Memory::magazineSize;
+	++total_depot_pushed;
+
+	return true;
+}
+
+bool XEPL::PoolOfBlocks::Pull_Magazine ( void )
+{
+	BlockHeader* magazine = MagazineDepot::depot_shelves[pool_index].Pull_Magazine();
+	if ( !magazine )
+		return false;
+
+	BlockHeader* last = magazine;
+	while ( last->next_block )
+		last = last->next_block;
+
+	last->next_block = head_block;
+	head_block       = magazine;
+	head_count      += Memory::magazineSize;
+	blocks_holding  += Memory::magazineSize;
+	blocks_pulled   += Memory::magazineSize;
+	++total_depot_pulled;
+
+	return true;
+}
+
+void XEPL::PoolOfBlocks::Catch_Slab ( void* _block )
+{
+	++blocks_holding;
+	*static_cast<void**> ( _block ) = free_slab;
+	free_slab = _block;
+}
+
+void* XEPL::PoolOfBlocks::Get_Or_Malloc( void )
+{
+	if ( void* slab_block = free_slab )
+	{
+		--blocks_holding;
+		++blocks_cached;
+		free_slab = *static_cast<void**> ( slab_block );
+		return slab_block;
+	}
+
+	BlockHeader* block = head_block;
+
+	if ( !block && Pull_Magazine() )
+		block = head_block;
+
+	if ( block )
+	{
+		--blocks_holding;
+		--head_count;
+		++blocks_cached;
+		head_block = block->next_block;
+	}
+	else
+	{
+		if ( slab_mode )
+			if ( void* slab_block = Carve_Slab() )
+				return slab_block;
+
+		++blocks_malloced;
+		block = static_cast<BlockHeader*> ( malloc ( block_size + sizeof ( BlockHeader ) ) );
+	}
+	block->owner.pool_index = static_cast<short> ( pool_index );
+	block->owner.heap_slot  = static_cast<short> ( heap_slot );
+	block->owner.heap_generation = heap_generation;
+
+	return block+1;
+}
+
+void* XEPL::PoolOfBlocks::Carve_Slab ( void )
+{
+	if ( static_cast<size_t> ( carve_limit - carve_next ) < block_size )
+	{
+		if ( !fresh_pages && !Add_Slab_Pages ( 1 ) )
+			return nullptr;
+
+		SlabPage* page = fresh_pages;
+		fresh_pages     = page->next_page;
+		page->next_page = slab_pages;
+		slab_pages      = page;
+
+		carve_next  = reinterpret_cast<char*> ( page ) + Memory::slabHeader;
+		carve_limit = reinterpret_cast<char*> ( page ) + Memory::slabPageSize;
+	}
+
+	++blocks_malloced;
+	++slab_pages->blocks_carved;
+
+	void* block = carve_next;
+	carve_next += block_size;
+
+	return block;
+}
+
+long XEPL::PoolOfBlocks::Add_Slab_Pages ( long _pages )
+{
+	long added = 0;
+
+	while ( added < _pages )
+	{
+		SlabPage* page = owner_heap->New_Page();
+		if ( !page )
+			break;
+
+		page->pool_index = pool_index;
+		page->heap_slot.store ( static_cast<short> ( heap_slot ), std::memory_order_relaxed );
+		page->next_page  = fresh_pages;
+		fresh_pages      = page;
+
+		++added;
+	}
+
+	slab_page_count  += added;
+	total_slab_pages += added;
+
+	return added;
+}
+
+void XEPL::PoolOfBlocks::Release_Slabs ( void )
+{
+	while ( void* block = free_slab )
+	{
+		free_slab = *static_cast<void**> ( block );
+		--SlabPage::Page_Of ( block )->blocks_carved;
+	}
+
+	while ( SlabPage* page = fresh_pages )
+	{
+		fresh_pages = page->next_page;
+		page->Free_Page();
+		++total_slab_pages_freed;
+	}
+
+	while ( SlabPage* page = slab_pages )
+	{
+		slab_pages = page->next_page;
+
+		if ( long live_blocks = page->blocks_carved )
+		{
+			page->heap_slot.store ( -1, std::memory_order_release );
+
+			if ( page->orphan_blocks.fetch_add ( live_blocks ) + live_blocks != 0 )
+				continue;
+		}
+
+		page->Free_Page();
+		++total_slab_pages_freed;
+	}
+}
+
+// required for operation
+std::atomic_size_t XEPL::pool_mallocs[] = {0};
+std::atomic_size_t XEPL::pool_cached[]  = {0};
+std::atomic_size_t XEPL::pool_freed[]   = {0};
+std::atomic_size_t XEPL::pool_held[]    = {0};
+
+// optional for observation
+std::atomic_size_t XEPL::total_mallocs     ( 0 );
+std::atomic_size_t XEPL::total_cached      ( 0 );
+std::atomic_size_t XEPL::total_freed       ( 0 );
+std::atomic_size_t XEPL::total_held        ( 0 );
+std::atomic_size_t XEPL::total_biggies_out ( 0 );
+std::atomic_size_t XEPL::total_biggies_in  ( 0 );
+std::atomic_size_t XEPL::largest_biggie    ( 0 );
+std::atomic_size_t XEPL::total_remote_frees     ( 0 );
+std::atomic_size_t XEPL::total_remote_reclaimed ( 0 );
+std::atomic_size_t XEPL::total_malloc_avoided   ( 0 );
+std::atomic_size_t XEPL::total_slab_pages       ( 0 );
+std::atomic_size_t XEPL::total_slab_pages_freed ( 0 );
+std::atomic_size_t XEPL::total_scratch_blocks      ( 0 );
+std::atomic_size_t XEPL::total_scratch_pages       ( 0 );
+std::atomic_size_t XEPL::total_scratch_pages_freed ( 0 );
+std::atomic_size_t XEPL::total_depot_pushed  ( 0 );
+std::atomic_size_t XEPL::total_depot_pulled  ( 0 );
+std::atomic_size_t XEPL::total_depot_drained ( 0 );
+std::atomic_size_t XEPL::total_huge_regions       ( 0 );
+std::atomic_size_t XEPL::total_huge_regions_freed ( 0 );
+std::atomic_size_t XEPL::total_huge_pages         ( 0 );
+std::atomic_size_t XEPL::total_trimmed            ( 0 );
+std::atomic_size_t XEPL::total_thread_heaps       ( 0 );
+std::atomic_size_t XEPL::total_orphaned           ( 0 );
+std::atomic_size_t XEPL::total_orphans_adopted    ( 0 );
+
+
+//    888888ba                                      dP                    a88888b.                              dP
+//    88    `8b                                     88                   d8'   `88                              88
+//   a88aaaa8P' .d8888b. .d8888b. dP    dP .d8888b. 88 .d8888b. 88d888b. 88        .d8888b. dP    dP 88d888b. d8888P .d8888b.
+//    88   `8b. 88ooood8 88'  `"" 88    88 88'  `"" 88 88ooood8 88'  `88 88        88'  `88 88    88 88'  `88   88   Y8ooooo.
+//    88     88 88.  ... 88.  ... 88.  .88 88.  ... 88 88.  ... 88       Y8.   .88 88.  .88 88.  .88 88    88   88         88
+//    dP     dP `88888P' `88888P' `8888P88 `88888P' dP `88888P' dP        Y88888P' `88888P' `88888P' dP    dP   dP   `88888P'
+//                                     .88
+//                                 d8888P
+
+XEPL::RecycleCounts::~RecycleCounts()
+{
+	long symbols = Symbols::Count();
+	Symbols::Release_Symbols();
+	OwnerBias::Release_Owners();
+
+	MagazineDepot::Drain_Shelves();
+	HeapOfPools::Drain_Orphans();
+
+	long biggies_out = total_biggies_out;
+	long biggies_in = total_biggies_in;
+
+	long leaking = total_mallocs - total_freed - total_held;
+	long slab_pages = total_slab_pages - total_slab_pages_freed;
+	long scratch_pages = total_scratch_pages - total_scratch_pages_freed;
+	long huge_regions  = total_huge_regions - total_huge_regions_freed;
+
+	if ( std_ostream && ( Show_Memory_Counts || leaking ) )
+	{
+		const long width = 13;
+
+		Print_Pool_Counts ( std_ostream, width );
+
+		String counts;
+		Long_Commafy ( biggies_out, &counts );
+		*std_ostream << "\nBiggies: " << std::setw( width ) << counts;
+
+		counts.assign(" :  Largest: " );
+		Long_In_Bytes ( largest_biggie, &counts );
+
+		*std_ostream << counts;
+
+		counts.clear();
+		Long_Commafy ( total_remote_frees, &counts );
+		*std_ostream << "\nRemote:  " << std::setw( width ) << counts;
+
+		counts.assign(" :  Reclaimed: " );
+		Long_Commafy ( total_remote_reclaimed, &counts );
+		counts.append(" :  Mallocs avoided: " );
+		Long_Commafy ( total_malloc_avoided, &counts );
+
+		*std_ostream << counts;
+
+		if ( total_slab_pages )
+		{
+			counts.clear();
+			Long_Commafy ( total_slab_pages, &counts );
+			*std_ostream << "\nSlabs:   " << std::setw( width ) << counts;
+
+			counts.assign(" :  Page: " );
+			Long_In_Bytes ( Memory::slabPageSize, &counts );
+			*std_ostream << counts;
+		}
+
+		if ( total_huge_regions )
+		{
+			counts.clear();
+			Long_Commafy ( total_huge_regions, &counts );
+			*std_ostream << "\nHuge:    " << std::setw( width ) << counts;
+
+			counts.assign(" :  Huge pages: " );
+			Long_Commafy ( total_huge_pages, &counts );
+			counts.append(" of " );
+			Long_Commafy ( total_slab_pages + total_scratch_pages, &counts );
+			*std_ostream << counts;
+		}
+
+		if ( symbols )
+		{
+			counts.clear();
+			Long_Commafy ( symbols, &counts );
+			*std_ostream << "\nSymbols: " << std::setw( width ) << counts;
+		}
+
+		if ( total_thread_heaps || total_orphaned )
+		{
+			counts.clear();
+			Long_Commafy ( total_thread_heaps, &counts );
+			*std_ostream << "\nThreads: " << std::setw( width ) << counts;
+
+			counts.assign(" :  Orphaned: " );
+			Long_Commafy ( total_orphaned, &counts );
+			counts.append(" :  Adopted: " );
+			Long_Commafy ( total_orphans_adopted, &counts );
+			*std_ostream << counts;
+		}
+
+		if ( total_trimmed )
+		{
+			counts.clear();
+			Long_Commafy ( total_trimmed, &counts );
+			*std_ostream << "\nTrimmed: " << std::setw( width ) << counts;
+		}
+
+		if ( total_depot_pushed )
+		{
+			counts.clear();
+			Long_Commafy ( total_depot_pushed, &counts );
+			*std_ostream << "\nDepot:   " << std::setw( width ) << counts;
+
+			counts.assign(" :  Pulled: " );
+			Long_Commafy ( total_depot_pulled, &counts );
+			counts.append(" :  Drained: " );
+			Long_Commafy ( total_depot_drained, &counts );
+			*std_ostream << counts;
+		}
+
+		if ( total_scratch_pages )
+		{
+			counts.clear();
+			Long_Commafy ( total_scratch_blocks, &counts );
+			*std_ostream << "\nScratch: " << std::setw( width ) << counts;
+
+			counts.assign(" :  Pages: " );
+			Long_Commafy ( total_scratch_pages, &counts );
+			*std_ostream << counts;
+		}
+
+		*std_ostream << std::endl;
+	}
+
+	if ( std_ostream && Show_Memory_Profile )
+		MemoryProfile::Print_Profile ( std_ostream );
+
+	if ( leaking )
+		std::cerr << " ***LEAKING " << leaking << " Recycled Allocations: " << std::endl;
+
+	if ( biggies_in-biggies_out )
+		std::cerr << " ***LEAKING " << biggies_in-biggies_out << " Biggie Allocations: " << std::endl;
+
+	if ( slab_pages )
+		std::cerr << " ***LEAKING " << slab_pages << " Slab Pages: " << std::endl;
+
+	if ( scratch_pages )
+		std::cerr << " ***LEAKING " << scratch_pages << " Scratch Pages: " << std::endl;
+
+	if ( huge_regions )
+		std::cerr << " ***LEAKING " << huge_regions << " Huge Regions: " << std::endl;
+}
+
+XEPL::RecycleCounts::RecycleCounts ( std::ostream* _ostream )
+	: std_ostream ( _ostream )
+{
+	total_mallocs     = 0;
+	total_cached      = 0;
+	total_freed       = 0;
+	total_held        = 0;
+	total_biggies_out = 0;
+	total_biggies_in  = 0;
+	largest_biggie    = 0;
+	total_remote_frees     = 0;
+	total_remote_reclaimed = 0;
+	total_malloc_avoided   = 0;
+	total_slab_pages       = 0;
+	total_slab_pages_freed = 0;
+	total_scratch_blocks      = 0;
+	total_scratch_pages       = 0;
+	total_scratch_pages_freed = 0;
+	total_depot_pushed        = 0;
+	total_depot_pulled        = 0;
+	total_depot_drained       = 0;
+	total_huge_regions        = 0;
+	total_huge_regions_freed  = 0;
+	total_huge_pages          = 0;
+	total_trimmed             = 0;
+	total_thread_heaps        = 0;
+	total_orphaned            = 0;
+	total_orphans_adopted     = 0;
+
+	MemoryProfile::Reset_Profile();
+}
+
+void XEPL::PoolOfBlocks::Report( String* _into )
+{
+	_into->append( std::to_string(block_size)     ).append( ":(" );
+	_into->append( std::to_string(blocks_malloced)).append(",");
+	_into->append( std::to_string(blocks_freed)   ).append(",");
+	_into->append( std::to_string(blocks_cached)  ).append(",");
+	_into->append( std::to_string(blocks_holding) );
+
+	if ( slab_page_count )
+		_into->append("|").append( std::to_string(slab_page_count) );
+
+	if ( blocks_pushed || blocks_pulled )
+		_into->append("~").append( std::to_string(blocks_pushed) ).append("/").append( std::to_string(blocks_pulled) );
+
+	_into->append(") ");
+}
+
+void XEPL::HeapOfPools::Report(String* _into )
+{
+	_into->append("[");
+	_into->append( std::to_string(largest_biggie_out) ).append( "," );
+	_into->append( std::to_string(count_biggies_out)  ).append( "/" );
+	_into->append( std::to_string(count_biggies_in)   ).append("] ");
+
+	_into->append("{");
+	_into->append( std::to_string(count_remote_frees)     ).append( "," );
+	_into->append( std::to_string(count_remote_reclaimed) ).append( "," );
+	_into->append( std::to_string(count_malloc_avoided)   ).append("} ");
+
+	if ( count_trims )
+	{
+		_into->append("T[");
+		_into->append( std::to_string(count_trims)   ).append( "," );
+		_into->append( std::to_string(count_trimmed) ).append( "," );
+		_into->append( std::to_string(bytes_trimmed) ).append("] ");
+	}
+
+	if ( count_huge_regions )
+	{
+		_into->append("H[");
+		_into->append( std::to_string(count_huge_regions) ).append( "," );
+		_into->append( std::to_string(count_huge_pages)   ).append( "/" );
+		_into->append( std::to_string(count_pages)        ).append("] ");
+	}
+
+	for ( long index = 1; index <= pool_count; ++index )
+		pool_of_blocks[index]->Report( _into );
+}
+
+void XEPL::Recycler::Report_Heap( String* _into )
+{
+	tlsHeap->Report( _into );
+}
+
+void XEPL::Recycler::Profile_Heap( Gene* _gene )
+{
+	if ( HeapOfPools* heap = tlsHeap )
+		heap->Profile_Into( _gene );
+}
+
+void XEPL::Recycler::Trim_Heap( long _decay )
+{
+	if ( HeapOfPools* heap = tlsHeap )
+		heap->Trim_Pools( _decay );
+}
+
+long XEPL::Recycler::Heap_Bytes( void )
+{
+	if ( HeapOfPools* heap = tlsHeap )
+		return heap->Bytes_In_Use();
+	return 0;
+}
+
+void XEPL::Recycler::Reclaim_Heap( void )
+{
+	if ( HeapOfPools* heap = tlsHeap )
+		heap->Reclaim_Remote_Blocks();
+}
+
+void XEPL::Recycler::Prewarm_Heap( long _pages )
+{
+	if ( HeapOfPools* heap = tlsHeap )
+		heap->Prewarm_Slabs( _pages );
+}
+
+void XEPL::RecycleCounts::Print_Pool_Counts ( std::ostream* _report, int _width )
+{
+	long malloc_bytes = 0;
+	long held_bytes   = 0;
+
+	String counts;
+	*_report << "\nPool:    " << std::setw ( _width ) << "Mallocs" << std::setw ( _width ) << "Freed"
+	         << std::setw ( _width ) << "Cached" << std::setw ( _width ) << "Held";
+
+	for ( long index = 1; index <= SizeClasses::pool_count; ++index )
+	{
+		if ( !pool_mallocs[index] && !pool_cached[index] )
+			continue;
+
+		*_report << "\n" << std::setw ( 6 ) << SizeClasses::class_bytes[index] << ( index > SizeClasses::class_count ? "^: " : " : " );
+
+		for ( std::atomic_size_t* array : { pool_mallocs, pool_freed, pool_cached, pool_held } )
+		{
+			counts.clear();
+			*_report << std::setw ( _width ) << *Long_Commafy ( array[index], &counts );
+		}
+
+		malloc_bytes += SizeClasses::class_bytes[index] * pool_mallocs[index];
+		held_bytes   += SizeClasses::class_bytes[index] * pool_held[index];
+	}
+
+	*_report << "\nTotal:  ";
+	for ( const std::atomic_size_t* total : { &total_mallocs, &total_freed, &total_cached, &total_held } )
+	{
+		counts.clear();
+		*_report << std::setw ( _width ) << *Long_Commafy ( *total, &counts );
+	}
+
+	counts.assign ( "  Malloced: " );
+	Long_In_Bytes ( malloc_bytes, &counts );
+	counts.append ( "  Held: " );
+	Long_In_Bytes ( held_bytes, &counts );
+	*_report << counts;
+}
+
+//    a88888b.                              dP
+//   d8'   `88                              88
+//   88        .d8888b. dP    dP 88d888b. d8888P .d8888b. 88d888b. .d8888b.
+//   88        88'  `88 88    88 88'  `88   88   88ooood8 88'  `88 Y8ooooo.
+//   Y8.   .88 88.  .88 88.  .88 88    88   88   88.  ... 88             88
+//    Y88888P' `88888P' `88888P' dP    dP   dP   `88888P' dP       `88888P'
+//
+
+	/// per thread counter descriptions
+	const char* XEPL::Counters::Counter_Descriptions = "\
+ genes:\
+ traits:\
+ lobes:\
+ neurons:\
+ dispatched:\
+ rests:\
+ actions:\
+ wakes:\
+ ";
+
+void XEPL::Counters::Add ( Counters* _counters )
+{
+	long record_size = sizeof ( Counters );
+	long number_of_counters = record_size/sizeof ( long );
+	Counter* scounter = (Counter*) ( _counters );
+	Counter* tcounter = (Counter*) ( this );
+
+	while ( number_of_counters-- )
+		*tcounter+++=*scounter++;
+}
+
+void XEPL::Counters::Report ( String* _string )
+{
+	String long_label ( Counter_Descriptions );
+	String lhs;
+	Counter* tcounter = (Counter*) ( this );
+
+	_string->append( "" );
+	while ( Split_ch_lhs ( &long_label, ':', &lhs ) )
+	{
+		_string->append ( lhs ).append ( ": " );
+		_string->append ( std::to_string ( *tcounter ) ).append ( " " );
+		tcounter++;
+	}
+}
+
+void XEPL::Counters::Final_Report()
+{
+	String long_label ( Counter_Descriptions );
+	String lhs;
+	Counter* tcounter = (Counter*) ( this );
+
+	String count;
+
+	while ( Split_ch_lhs ( &long_label, ':', &lhs ) )
+	{
+		count.clear();
+		Long_Commafy ( *tcounter++, &count );
+		std::cout << std::setw ( 12 ) << lhs << std::setw ( 15 )
+		          << count << '\n';
+	}
+
+	std::cout << std::flush;
+}
+
+//    .d888888    dP
+//   d8'    88    88
+//   88aaaaa88a d8888P .d8888b. 88d8b.d8b.
+//   88     88    88   88'  `88 88'`88'`88
+//   88     88    88   88.  .88 88  88  88
+//   88     88    dP   `88888P' dP  dP  dP
+//
+
+XEPL::Atom::~Atom( void )
+{
+	if ( Owned_Here() )
+		--tlsBias->biased_atoms;
+}
+
+void  XEPL::Atom::Release( void )
+{
+	if ( Owned_Here() )
+	{
+		if ( --biased_count == 0 && Unbias() )
+			delete this;
+		return;
+	}
+
+	BiasCount was = shared_count.load ( std::memory_order_relaxed );
+	BiasCount now;
+	do
+	{
+		now = was - bias_unit;
+		if ( !( was & bias_merged ) && now < 0 )
+			now |= bias_queued;
+	}
+	while ( !shared_count.compare_exchange_weak ( was, now, std::memory_order_acq_rel, std::memory_order_relaxed ) );
+
+	if ( now & bias_merged )
+	{
+		if ( now < bias_unit )
+			delete this;
+		return;
+	}
+
+	if ( ( now & bias_queued ) && !( was & bias_queued ) && !Bias_Owner()->Queue_Merge ( this ) )
+	{
+		OwnerBias* owner = Bias_Owner();
+		bool       dead  = Merge_Bias();
+
+		owner->Orphan_Merged();
+
+		if ( dead )
+			delete this;
+	}
+}
+
+XEPL::Atom* XEPL::Atom::Escape ( void )
+{
+	if ( Owned_Here() )
+		Unbias();
+
+	return this;
+}
+
+bool XEPL::Atom::Unbias ( void )
+{
+	uint16_t  biased = biased_count;
+	BiasCount was    = shared_count.load ( std::memory_order_relaxed );
+	BiasCount now;
+
+	biased_count = 0;
+	do
+	{
+		if ( was & bias_queued )
+		{
+			biased_count = biased;
+			return false;
+		}
+		now = was + biased * bias_unit + bias_merged;
+	}
+	while ( !shared_count.compare_exchange_weak ( was, now, std::memory_order_acq_rel, std::memory_order_relaxed ) );
+
+	--tlsBias->biased_atoms;
+
+	return now < bias_unit;
+}
+
+bool XEPL::Atom::Merge_Bias ( void )
+{
+	BiasCount merging = biased_count * bias_unit + bias_merged;
+
+	biased_count = 0;
+
+	return shared_count.fetch_add ( merging, std::memory_order_acq_rel ) + merging < bias_unit;
+}
+
+static_assert ( XEPL::Memory::biasSlots <= 0x10000, "an atom keeps its bias slot in 16 bits" );
+
+std::mutex        XEPL::OwnerBias::owners_lock;
+XEPL::OwnerBias*  XEPL::OwnerBias::owner_slots[Memory::biasSlots];
+
+XEPL::OwnerBias::OwnerBias ( int _slot )
+	: bias_slot     ( _slot )
+	, merge_lock    ()
+	, merge_queue   ()
+	, merge_pending ( false )
+	, owner_gone    ( false )
+	, biased_atoms  ( 0 )
+	, orphan_atoms  ( 0 )
+{}
+
+void XEPL::OwnerBias::Claim_Thread ( void )
+{
+	std::lock_guard<std::mutex> lock_owners ( owners_lock );
+
+	for ( int slot = 1; slot < Memory::biasSlots; ++slot )
+	{
+		if ( !owner_slots[slot] )
+		{
+			tlsBias = owner_slots[slot] = new OwnerBias ( slot );
+			return;
+		}
+	}
+}
+
+bool XEPL::OwnerBias::Queue_Merge ( Atom* _atom )
+{
+	std::lock_guard<std::mutex> lock_merge ( merge_lock );
+
+	if ( owner_gone )
+		return false;
+
+	merge_queue.push_back ( _atom );
+	merge_pending.store ( true, std::memory_order_release );
+
+	return true;
+}
+
+void XEPL::OwnerBias::Merge_Queued ( void )
+{
+	OwnerBias* owner = tlsBias;
+
+	if ( !owner || !owner->merge_pending.load ( std::memory_order_acquire ) )
+		return;
+
+	std::vector<Atom*, TAllocatorT<Atom*>> merging;
+	{
+		std::lock_guard<std::mutex> lock_merge ( owner->merge_lock );
+		merging.swap ( owner->merge_queue );
+		owner->merge_pending.store ( false, std::memory_order_relaxed );
+	}
+
+	for ( Atom* atom : merging )
+	{
+		--owner->biased_atoms;
+		if ( atom->Merge_Bias() )
+			delete atom;
+	}
+}
+
+void XEPL::OwnerBias::Vacate_Thread ( void )
+{
+	OwnerBias* owner = tlsBias;
+
+	while ( owner )
+	{
+		Merge_Queued();
+
+		std::unique_lock<std::mutex> lock_merge ( owner->merge_lock );
+
+		if ( owner->merge_queue.empty() )
+		{
+			owner->owner_gone = true;
+			owner->orphan_atoms.store ( owner->biased_atoms, std::memory_order_release );
+			lock_merge.unlock();
+
+			if ( !owner->biased_atoms )
+				owner->Reclaim();
+
+			tlsBias = owner = nullptr;
+		}
+	}
+}
+
+void XEPL::OwnerBias::Orphan_Merged ( void )
+{
+	if ( orphan_atoms.fetch_sub ( 1, std::memory_order_acq_rel ) == 1 )
+		Reclaim();
+}
+
+void XEPL::OwnerBias::Reclaim ( void )
+{
+	std::lock_guard<std::mutex> lock_owners ( owners_lock );
+
+	owner_slots[bias_slot] = nullptr;
+
+	delete this;
+}
+
+void XEPL::OwnerBias::Release_Owners ( void )
+{
+	std::lock_guard<std::mutex> lock_owners ( owners_lock );
+
+	for ( OwnerBias*& owner : owner_slots )
+	{
+		delete owner;
+		owner = nullptr;
+	}
+}
+
+
+//    a88888b. dP                oo
+//   d8'   `88 88
+//   88        88d888b. .d8888b. dP 88d888b.
+//   88        88'  `88 88'  `88 88 88'  `88
+//   Y8.   .88 88    88 88.  .88 88 88    88
+//    Y88888P' dP    dP `88888P8 dP dP    dP
+//
+
+template <class TAtom, class TLock>
+XEPL::ChainT<TAtom, TLock>::~ChainT ( void )
+{
+	if ( !head_bond )
+		return;
+
+	std::lock_guard<TLock> lock_chain ( chain_lock );
+
+	Bond* bond = head_bond;
+	while ( bond )
+	{
+		Bond* next = bond->next_bond;
+		delete bond;
+		bond = next;
+	}
+}
+
+template <class TAtom, class TLock>
+XEPL::ChainT<TAtom, TLock>::ChainT ( void )
+	: chain_lock  ()
+	, head_bond   ( nullptr )
+	, tail_bond   ( nullptr )
+{}
+
+template <class TAtom, class TLock>
+XEPL::ChainT<TAtom, TLock>::ChainT ( TAtom* _atom )
+	: chain_lock ()
+	, head_bond  ( new Bond ( _atom, nullptr ) )
+	, tail_bond  ( head_bond )
+{}
+
+template <class TAtom, class TLock>
+XEPL::Bond* XEPL::ChainT<TAtom, TLock>::Add_Atom ( TAtom* _atom )
+{
+	std::lock_guard<TLock> lock_chain ( chain_lock );
+
+	Bond* fresh_bond = new Bond ( _atom, tail_bond );
+
+	if ( !head_bond )
+		head_bond = fresh_bond;
+	else
+		tail_bond->next_bond = fresh_bond;
+
+	tail_bond = fresh_bond;
+
+	return fresh_bond;
+}
+
+template <class TAtom, class TLock>
+bool XEPL::ChainT<TAtom, TLock>::Pull_Atom ( TAtom** _atom )
+{
+	std::lock_guard<TLock> lock_chain ( chain_lock );
+
+	if ( head_bond )
+	{
+		Bond* last_head = head_bond;
+
+		*_atom = static_cast<TAtom*> ( head_bond->Unbind() );
+
+		head_bond = head_bond->next_bond;
+
+		delete last_head;
+
+		if ( head_bond )
+			head_bond->prev_bond = nullptr;
+		else
+			tail_bond = nullptr;
+
+		return true;
+	}
+
+	return false;
+}
+
+template <class TAtom, class TLock>
+bool XEPL::ChainT<TAtom, TLock>::Remove_Atom ( TAtom* _atom )
+{
+	std::lock_guard<TLock> lock_chain ( chain_lock );
+
+	Bond* bond = head_bond;
+
+	while ( bond && bond->atom != _atom )
+		bond=bond->next_bond;
+
+	if ( !bond )
+		return !!head_bond;
+
+	if ( bond == head_bond )
+		head_bond = bond->next_bond;
+	else
+		bond->prev_bond->next_bond = bond->next_bond;
+
+	if ( bond == tail_bond )
+		tail_bond = bond->prev_bond;
+	else
+		bond->next_bond->prev_bond = bond->prev_bond;
+
+	delete bond;
+
+	return !head_bond;
+}
+
+template <class TAtom, class TLock>
+bool XEPL::ChainT<TAtom, TLock>::Remove_Bond ( Bond* _bond )
+{
+	std::lock_guard<TLock> lock_chain ( chain_lock );
+
+	if ( _bond->prev_bond )
+		_bond->prev_bond->next_bond = _bond->next_bond;
+	else
+		head_bond = _bond->next_bond;
+
+	if ( _bond->next_bond )
+		_bond->next_bond->prev_bond = _bond->prev_bond;
+	else
+		tail_bond = _bond->prev_bond;
+
+	delete _bond;
+
+	return !head_bond;
+}
+
+template <class TAtom, class TLock>
+XEPL::Bond* XEPL::ChainT<TAtom, TLock>::Detach_Bonds ( void )
+{
+	std::lock_guard<TLock> lock_chain ( chain_lock );
+
+	Bond* bonds = head_bond;
+
+	head_bond = nullptr;
+	tail_bond = nullptr;
+
+	return bonds;
+}
+
+template class XEPL::ChainT<XEPL::Gene,     XEPL::NoLock>;
+template class XEPL::ChainT<XEPL::Neuron,   XEPL::Mutex>;
+template class XEPL::ChainT<XEPL::Axon,     XEPL::Mutex>;
+template class XEPL::ChainT<XEPL::Receptor, XEPL::Mutex>;
+
+
+//    a88888b.          dP dP
+//   d8'   `88          88 88
+//   88        .d8888b. 88 88
+//   88        88ooood8 88 88
+//   Y8.   .88 88.  ... 88 88
+//    Y88888P' `88888P' dP dP
+//
+
+XEPL::Cell::~Cell()
+{}
+
+XEPL::Cell::Cell ( Cord* _cord )
+	: Atom()
+	, cell_name ( Symbols::Intern ( _cord ) )
+{}
+
+XEPL::Cell::Cell ( Text* _chars )
+	: Atom()
+	, cell_name ( Symbols::Intern ( _chars ) )
+{}
+
+//    a88888b.                     dP
+//   d8'   `88                     88
+//   88        .d8888b. 88d888b. d8888P .d8888b. dP.  .dP
+//   88        88'  `88 88'  `88   88   88ooood8  `8bd8'
+//   Y8.   .88 88.  .88 88         88   88.  ...  .d88b.
+//    Y88888P' `88888P' dP         dP   `88888P' dP'  `dP
+//
+
+XEPL::Cortex* XEPL::cortex = nullptr;
+
+void XEPL::Cortex::Close_Cortex( void )
+{
+	if( !host_lobe->index_link )
+		return;
+
+	host_lobe->Lobe_Dying();
+	host_lobe->index_link->Release();
+	host_lobe->indicies.Unstack( host_lobe );
+	host_lobe->index_link = nullptr;
+}
+
+XEPL::Cortex::~Cortex()
+{
+	Close_Cortex();
+
+	host_lobe->Release();
+	host_lobe = nullptr;
+	tlsLobe   = nullptr;
+	
+	delete keywords_map;
+	delete operators_map;
+	delete render_map;
+	delete mutual_map;
+	delete commands_map;
+
+	cortex  = nullptr;
+
+	if ( Show_Counters )
+		final_counters.Final_Report();
+}
+
+XEPL::Cortex::Cortex ( Text* _name, std::ostream& _ostream, long _linear_limit, long _pooled_limit, PagePolicy _page_policy )
+	: memory_counts    ( &_ostream )
+	, recycle_counts   ( &_ostream )
+	, size_classes     ( _linear_limit, _pooled_limit )
+	, memory_backpack  ( _page_policy )
+	, keywords_map     ( new KeywordsMap()  )
+	, operators_map    ( new OperatorsMap() )
+	, commands_map     ( new CommandsMap()  )
+	, mutual_map       ( new MutualsMap()   )
+	, render_map       ( new RenderMap()    )
+	, host_lobe        ( tlsLobe = new Lobe ( _name ) )
+	, short_term_memories()
+	, final_counters   ()
+{
+	
+	cortex  = this;
+
+	Set_Thread_Name ( host_lobe->cpp_thread, _name );
+
+	host_lobe->Attach();
+	host_lobe->indicies.Stack(host_lobe, new Gene ( nullptr, "Index", host_lobe->cell_name ));
+	host_lobe->Lobe_Born();
+}
+
+void XEPL::Cortex::Register_Command ( Text* _chars, Command _command )
+{
+	if ( !_chars )
+		return;
+
+	String name_cord ( _chars );
+
+	auto [it, noob] = commands_map->insert_or_assign ( name_cord, _command );
+
+	if (!noob)
+		ErrorReport error_report("Replaced command: ", &name_cord );
+
+	TRACE( "New_Command", nullptr, &name_cord);
+}
+
+bool XEPL::Cortex::Did_Command ( Text* _chars )
+{
+	if ( !_chars || !*_chars )
+		return false;
+
+	std::string_view command_line ( _chars );
+	size_t           split = command_line.find ( ' ' );
+
+	auto it  = commands_map->find ( command_line.substr ( 0, split ) );
+	if ( it != commands_map->end() )
+	{
+		String opt ( _chars + ( split == std::string_view::npos ? 0 : split+1 ) );
+		( *it->second ) ( &opt );
+		return true;
+	}
+
+	if ( tlsLobe->Performed_Method ( command_line, nullptr ) )
+		return true;
+
+	ErrorReport error_report( "Command not understood: ", _chars );
+	return false;
+}
+
+bool XEPL::Cortex::Did_Dot_Tag ( Nucleus* _nucleus, Gene* _call_gene )
+{
+	String  neuron_name;
+	String  method_name;
+	Neuron* target_neuron = nullptr;
+
+	Split_ch_lhs_rhs ( _call_gene->cell_name, '.', &neuron_name, &method_name );
+
+	if ( _nucleus->Host()->Find_Neuron ( &neuron_name, &target_neuron ) )
+		return target_neuron->Performed_Method ( &method_name, _call_gene );
+
+	return false;
+}
+
+void XEPL::Cortex::Register_Keyword ( Text* _chars, Keyword _keyword )
+{
+	if (!_chars)
+		return;
+
+	Cord* name_cord = Symbols::Intern ( _chars );
+
+	auto [it, noob] = keywords_map->insert_or_assign(name_cord, _keyword);
+
+	if (!noob)
+		ErrorReport error_report("Replaced keyword: ", name_cord);
+
+	TRACE( "New_Keyword", nullptr, name_cord);
+}
+
+bool XEPL::Cortex::Did_Keyword ( Nucleus* _nucleus, Gene* _call_gene )
+{
+	auto it  = keywords_map->find ( _call_gene->cell_name );
+	if ( it == keywords_map->end() )
+		return false;
+
+	auto host = _nucleus->Host();
+
+	String param;
+	String* param_string = &param;
+
+	XEPL::String content;
+	if ( _call_gene->Copy_Content(&content) )
+	{
+		if ( *content.c_str() == '{' )
+			Script ( host, _call_gene, &param );
+		else
+			param_string = &content;
+	}
+
+	if ( Show_Trace )
+	{
+		String trace_string;
+		_call_gene->Print_Into(&trace_string, 1);
+		TRACE( "DO_Keyword", _nucleus->Host(), &trace_string, param_string );
+	}
+
+	it->second ( _nucleus->Host(), _call_gene, param_string );
+
+	return true;
+}
+
+XEPL::Gene* XEPL::Cortex::Locate_Gene ( Nucleus* _nucleus, Cord* _gene_name )
+{
+	if ( auto ephemerals = tlsLobe->ephemerals )
+	{
+		auto it  = ephemerals->find ( *_gene_name );
+		if ( it != ephemerals->end() )
+			return it->second;
+	}
+
+	Nucleus* current_nucleus = _nucleus;
+	Gene*    located_gene    = nullptr;
+	Gene*    vitals          = nullptr;
+
+	while ( current_nucleus )
+	{
+		if ( current_nucleus->observer->Get_First_Gene("Vitals", &vitals ) )
+			if ( vitals->inner_genes && ( vitals->Get_First_Gene ( _gene_name, &located_gene ) ) )
+				return located_gene;
+
+		current_nucleus = current_nucleus->parent_neuron;
+	}
+
+	auto it  = cortex->mutual_map->find ( *_gene_name );
+	if ( it != cortex->mutual_map->end() )
+		return it->second ( _nucleus );
+
+	return nullptr;
+}
+
+XEPL::Neuron* XEPL::Cortex::Locate_Neuron ( Nucleus* _nucleus, Cord* _cord, char _split_char )
+{
+	Neuron* neuron = nullptr;
+
+	size_t spot = _cord->find ( _split_char );
+	if ( spot  == _cord->npos )
+	{
+		_nucleus->Host()->Find_Neuron ( _cord, &neuron );
+		return neuron;
+	}
+
+	Cord* remaining_path = _cord;
+	String neuron_name;
+	String neuron_root;
+
+	neuron = cortex->host_lobe;
+	
+	while ( neuron && Split_ch_lhs_rhs ( remaining_path, _split_char, &neuron_root, &neuron_name ) )
+	{
+		if ( !neuron->Find_Neuron ( &neuron_root, &neuron ) )
+			break;
+		remaining_path = &neuron_name;
+	}
+
+	if ( neuron )
+		neuron->Find_Neuron ( &neuron_name, &neuron );
+
+	return neuron;
+}
+
+XEPL::Axon* XEPL::Cortex::Locate_Axon ( Nucleus* _nucleus, Cord* _cord, char _split_char )
+{
+	if ( !_cord )
+		return nullptr;
+
+	Axon* located_axon = nullptr;
+
+	String  axon_name;
+	String  path_string;
+
+	if ( Split_ch_lhs_rhs ( _cord, _split_char, &path_string, &axon_name ) )
+	{
+		Neuron* located_neuron = nullptr;
+		if ( _nucleus->Host()->Find_Neuron ( &path_string, &located_neuron ) )
+			located_neuron->Get_Axon ( &axon_name, &located_axon );
+	}
+	else
+		_nucleus->Host()->Hunt_Axon ( &axon_name, &located_axon );
+
+	return located_axon;
+}
+
+void XEPL::Cortex::Register_Mutual ( Text* _chars, Mutual _mutual )
+{
+	String name_cord ( _chars );
+
+	auto [it, noob] = mutual_map->insert_or_assign ( name_cord, _mutual );
+
+	if (!noob)
+		ErrorReport error_report("Replaced mutual: ", &name_cord);
+}
+
+void XEPL::Cortex::Register_Operator ( Text* _chars, Operator _operator )
+{
+	if ( !_chars )
+		return;
+
+	Cord operator_name ( _chars );
+
+	auto [it, noob] = operators_map->insert_or_assign ( operator_name, _operator );
+
+	if (!noob)
+		ErrorReport error_report("Replaced operator: ", &operator_name);
+
+	TRACE( "New_Operator", nullptr, &operator_name);
+}
+
+bool XEPL::Cortex::Did_Operator ( Cord* _operator_name, Script* _script, Cord* _param )
+{
+	auto it  = operators_map->find ( *_operator_name );
+	if ( it == operators_map->end() )
+		return false;
+
+	it->second ( _script, _param );
+
+	return true;
+}
+
+
+bool XEPL::Cortex::Execute_As_Xml ( XEPL::Text* _chars )
+{
+	XEPL::Gene* gene = new XEPL::Gene ( _chars );
+
+	XEPL::ShortTerms nesting ( gene );
+
+	if ( !XEPL::tlsLobe->Process_Gene ( gene ) )
+		XEPL::xeplCantFind ( "Cmd", XEPL::tlsLobe, gene->cell_name );
+
+	gene->Release();
+
+	return true;
+}
+
+bool XEPL::Cortex::Execute_As_Rna ( XEPL::Text* _chars, XEPL::String* _result_string )
+{
+	XEPL::Cord   rna_cord ( _chars );
+
+	XEPL::ShortTerms nesting;
+
+	auto lobe = XEPL::tlsLobe;
+
+	XEPL::Script ( lobe, lobe->index_link, &rna_cord, _result_string );
+
+	return true;
+}
+
+
+void XEPL::Cortex::Register_Render ( Text* _chars, Render _render )
+{
+	Cord name_cord(_chars);
+
+	auto [it, noob] = render_map->insert_or_assign( name_cord, _render );
+
+	if (!noob)
+		ErrorReport error_report("Replaced render: ", &name_cord);
+
+	TRACE( "New_Render", nullptr, &name_cord);
+}
+
+bool XEPL::Cortex::Did_Render ( Nucleus* _nucleus, Gene* _gene, Rendon* _rendon )
+{
+	DuplicateTraits duplicate ( _gene );
+	duplicate.gene->Evaluate_Traits ( _nucleus );
+
+	auto it  = render_map->find ( *duplicate.gene->cell_name );
+	if ( it == render_map->end() )
+		return _nucleus->Took_Action(duplicate.gene);
+
+	it->second ( _nucleus, duplicate.gene, _rendon );
+	return true;
+}
+
+//    .88888.
+//   d8'   `88
+//   88        .d8888b. 88d888b. .d8888b.
+//   88   YP88 88ooood8 88'  `88 88ooood8
+//   Y8.   .88 88.  ... 88    88 88.  ...
+//    `88888'  `88888P' dP    dP `88888P'
+
+XEPL::Gene::~Gene()
+{
+	delete gene_extension.load();
+
+	delete traits;
+	if ( !Test_Flags(dupe_flag) )
+	{
+		Orphan_Genes();
+		delete inner_genes;
+
+		if ( content_wire )
+			content_wire->Release();
+	}
+	if(auto lobe=tlsLobe)--lobe->counters.count_genes;
+}
+
+XEPL::Gene::Gene ( Text* _xml )
+	: Cell ( "")
+	, content_wire    ( nullptr )
+	, traits          ( nullptr )
+	, inner_genes     ( nullptr )
+	, owner_link      ( nullptr )
+	, gene_extension  ( nullptr )
+{
+	++tlsLobe->counters.count_genes;
+
+	Cord text ( _xml );
+	Gene* parsed_gene = new Gene( nullptr, "text", nullptr);
+
+	XmlParser parser ( parsed_gene, &text );
+
+	if ( parser.ParseIt() )
+	{
+		Gene* gene=parsed_gene->First();
+
+		cell_name = gene->cell_name;
+		
+		if ( Cord* space = gene->Space_String() )
+			Extension()->space_string = space;
+
+		Absorb_Gene ( gene );
+	}
+	parsed_gene->Release();
+}
+
+XEPL::Gene::Gene ( Gene* _parent, Cord* _name, Cord* _space )
+	: Cell ( _name )
+	, content_wire    ( nullptr )
+	, traits          ( nullptr )
+	, inner_genes     ( nullptr )
+	, owner_link      ( _parent )
+	, gene_extension  ( nullptr )
+{
+	if(auto lobe=tlsLobe)++lobe->counters.count_genes;
+
+	if ( _space )
+		Extension()->space_string = Symbols::Intern ( _space );
+
+	if ( !_parent )
+		return;
+
+	if ( GeneOwner* owner = _parent->Gene_Owner() )
+	{
+		owner->Attach();
+		Extension()->gene_owner = owner;
+	}
+
+	if ( _parent->Write_Refused ( "Add_Gene" ) )
+	{
+		Park_Refused();
+		return;
+	}
+
+	_parent->Add_Gene ( this );
+	Release();
+}
+
+XEPL::Gene::Gene ( Gene* _parent, Text* _name, Cord* _space )
+	: Cell ( _name )
+	, content_wire    ( nullptr )
+	, traits          ( nullptr )
+	, inner_genes     ( nullptr )
+	, owner_link      ( _parent )
+	, gene_extension  ( nullptr )
+{
+	if(auto lobe=tlsLobe)++lobe->counters.count_genes;
+
+	if ( _space )
+		Extension()->space_string = Symbols::Intern ( _space );
+
+	if ( !_parent )
+		return;
+
+	if ( GeneOwner* owner = _parent->Gene_Owner() )
+	{
+		owner->Attach();
+		Extension()->gene_owner = owner;
+	}
+
+	if ( _parent->Write_Refused ( "Add_Gene" ) )
+	{
+		Park_Refused();
+		return;
+	}
+
+	_parent->Add_Gene ( this );
+	Release();
+}
+
+XEPL::Gene::Gene ( Gene* _parent, Cord* _name )
+	: Gene( _parent, _name, nullptr )
+{}
+
+void XEPL::Gene::Deflate_Gene ( void )
+{
+	if ( Remote_Owner() )
+		return Post_To_Owner ( new GeneAction ( this, mutate_deflate, nullptr ) );
+
+	WriteScope lock_Contents ( Lock_Gene() );
+
+	if ( Write_Refused ( "Deflate_Gene" ) )
+		return;
+
+	if ( content_wire )
+	{
+		content_wire->Release();
+		content_wire=nullptr;
+	}
+
+	if ( GeneExtension* extension = gene_extension.load() )
+		extension->content_string.clear();
+	Clear_Flags ( content_flag );
+
+	Orphan_Genes();
+
+	delete traits;
+	delete inner_genes;
+
+	inner_genes = nullptr;
+	traits      = nullptr;
+}
+
+void XEPL::Gene::Print_Into ( String* _string, int _depth )
+{
+	if ( !_string )
+		return;
+
+	XmlBuilder x1 ( cell_name, _string, Space_String() );
+
+	{
+		ReadScope  lock_Contents ( Read_Lock() );
+
+		if ( traits )
+			traits->Print_Into ( _string );
+
+		if ( content_wire )
+		{
+			x1.Close_Attributes();
+
+			content_wire->Print_Into ( _string );
+		}
+		else if ( Test_Flags ( content_flag ) )
+		{
+			x1.Close_Attributes();
+
+			_string->append ( gene_extension.load()->content_string );
+		}
+	}
+
+	if ( --_depth )
+	{
+		if ( inner_genes )
+		{
+			x1.Close_Attributes();
+			inner_genes->Print_Into ( _string, _depth );
+		}
+	}
+}
+
+void XEPL::Gene::Freeze ( void )
+{
+	{
+		WriteScope lock_Contents ( Lock_Gene() );
+
+		if ( Test_Flags ( frozen_flag ) )
+			return;
+
+		if ( traits && traits->Has_Scripts() )
+		{
+			Set_Flags ( scripted_flag );
+			Share_Content();
+		}
+
+		Set_Flags ( frozen_flag );
+	}
+
+	if ( !inner_genes )
+		return;
+
+	for ( Bond* bond = inner_genes->head_bond; bond; bond = bond->next_bond )
+		Genes::Atom_Of ( bond )->Freeze();
+}
+
+void XEPL::Gene::Frozen_Copy ( Gene** _frozen )
+{
+	if ( Test_Flags ( frozen_flag ) )
+	{
+		Attach();
+		*_frozen = this;
+		return;
+	}
+
+	Gene* copy = new Gene ( nullptr, cell_name, Space_String() );
+
+	Duplicate_Traits ( &copy->traits );
 
-	if ( Split_ch_lhs_rhs ( _cord, _split_char, &path_string, &axon_name ) )
+	String content;
+	if ( Copy_Content ( &content ) )
+		copy->Append_Content ( std::move ( content ) );
+
+	if ( inner_genes )
 	{
-		Neuron* located_neuron = nullptr;
-		if ( _nucleus->Host()->Find_Neuron ( &path_string, &located_neuron ) )
-			located_neuron->Get_Axon ( &axon_name, &located_axon );
+		StableGenes recall ( this );
+
+		Gene* gene = nullptr;
+		while ( recall.Next_Gene ( &gene ) )
+		{
+			Gene* inner_copy = nullptr;
+			gene->Frozen_Copy ( &inner_copy );
+			copy->Add_Gene ( inner_copy );
+			inner_copy->Release();
+		}
 	}
-	else
-		_nucleus->Host()->Hunt_Axon ( &axon_name, &located_axon );
 
-	return located_axon;
+	copy->Freeze();
+
+	*_frozen = copy;
 }
 
-void XEPL::Cortex::Register_Mutual ( Text* _chars, Mutual _mutual )
+bool XEPL::Gene::Write_Refused ( Text* _mutation )
 {
-	String name_cord ( _chars );
+	if ( Test_Flags ( frozen_flag ) )
+	{
+		ErrorReport error_report ( _mutation, " refused, frozen Gene: " );
+		error_report.append ( *cell_name );
 
-	auto [it, noob] = mutual_map->insert_or_assign ( name_cord, _mutual );
+		return true;
+	}
 
-	if (!noob)
-		ErrorReport error_report("Replaced mutual: ", &name_cord);
+	if ( Test_Flags ( versioned_flag ) )
+		Retire_Versions();
+
+	return false;
 }
 
-void XEPL::Cortex::Register_Operator ( Text* _chars, Operator _operator )
+void XEPL::Gene::Park_Refused ( void )
 {
-	if ( !_chars )
-		return;
+	owner_link = nullptr;
 
-	Cord operator_name ( _chars );
-
-	auto [it, noob] = operators_map->insert_or_assign ( operator_name, _operator );
+	Lobe* lobe = tlsLobe;
+	if ( !lobe )
+		return;
 
-	if (!noob)
-		ErrorReport error_report("Replaced operator: ", &operator_name);
+	if ( !lobe->refused_genes )
+		lobe->refused_genes = new ChainT<Gene, NoLock>();
 
-	TRACE( "New_Operator", nullptr, &operator_name);
+	lobe->refused_genes->Add_Atom ( this );
+	Release();
 }
 
-bool XEPL::Cortex::Did_Operator ( Cord* _operator_name, Script* _script, Cord* _param )
+void XEPL::Gene::Retire_Versions ( void )
 {
-	auto it  = operators_map->find ( *_operator_name );
-	if ( it == operators_map->end() )
-		return false;
+	GeneVersion* retired = nullptr;
+	Gene*        gene    = this;
 
-	it->second ( _script, _param );
+	GeneLock::Hold_Link ( gene );
 
-	return true;
-}
+	while ( gene )
+	{
+		gene->Count_Edit();
 
+		if ( GeneExtension* extension = gene->gene_extension.load() )
+			if ( GeneVersion* version = extension->gene_version.exchange ( nullptr ) )
+			{
+				version->retired_next = retired;
+				retired = version;
+			}
 
-bool XEPL::Cortex::Execute_As_Xml ( XEPL::Text* _chars )
-{
-	XEPL::Gene* gene = new XEPL::Gene ( _chars );
+		Gene* owner = gene->Test_Flags ( embedded_flag ) ? gene->owner_link : nullptr;
 
-	XEPL::ShortTerms nesting ( gene );
+		if ( owner )
+			GeneLock::Hold_Link ( owner );
 
-	if ( !XEPL::tlsLobe->Process_Gene ( gene ) )
-		XEPL::xeplCantFind ( "Cmd", XEPL::tlsLobe, gene->cell_name );
+		GeneLock::Drop_Link ( gene );
 
-	gene->Release();
+		gene = owner;
+	}
 
-	return true;
+	if ( retired )
+		GeneVersion::Retire ( retired );
 }
 
-bool XEPL::Cortex::Execute_As_Rna ( XEPL::Text* _chars, XEPL::String* _result_string )
+void XEPL::Gene::Orphan_Genes ( void )
 {
-	XEPL::Cord   rna_cord ( _chars );
+	if ( !inner_genes )
+		return;
 
-	XEPL::ShortTerms nesting;
+	bool versioned = Test_Flags ( versioned_flag );
 
-	auto lobe = XEPL::tlsLobe;
+	for ( Bond* bond = inner_genes->head_bond; bond; bond = bond->next_bond )
+	{
+		Gene* gene = Genes::Atom_Of ( bond );
 
-	XEPL::Script ( lobe, lobe->index_link, &rna_cord, _result_string );
+		if ( versioned )
+			GeneLock::Hold_Link ( gene );
 
-	return true;
-}
+		if ( gene->owner_link == this )
+		{
+			gene->Clear_Flags ( embedded_flag );
+			gene->owner_link = nullptr;
+		}
 
+		if ( versioned )
+			GeneLock::Drop_Link ( gene );
+	}
+}
 
-void XEPL::Cortex::Register_Render ( Text* _chars, Render _render )
+void XEPL::Gene::Own ( Lobe* _lobe )
 {
-	Cord name_cord(_chars);
+	GeneOwner* owner = _lobe ? _lobe->gene_owner : nullptr;
 
-	auto [it, noob] = render_map->insert_or_assign( name_cord, _render );
+	if ( owner )
+		owner->Attach();
 
-	if (!noob)
-		ErrorReport error_report("Replaced render: ", &name_cord);
+	if ( GeneExtension* extension = owner ? Extension() : gene_extension.load() )
+		if ( GeneOwner* was = extension->gene_owner.exchange ( owner ) )
+			was->Release();
 
-	TRACE( "New_Render", nullptr, &name_cord);
+	ReadScope lock_Contents ( Lock_Gene() );
+
+	if ( !inner_genes )
+		return;
+
+	for ( Bond* bond = inner_genes->head_bond; bond; bond = bond->next_bond )
+		Genes::Atom_Of ( bond )->Own ( _lobe );
 }
 
-bool XEPL::Cortex::Did_Render ( Nucleus* _nucleus, Gene* _gene, Rendon* _rendon )
+void XEPL::Gene::Post_To_Owner ( GeneAction* _action )
 {
-	DuplicateTraits duplicate ( _gene );
-	duplicate.gene->Evaluate_Traits ( _nucleus );
+	GeneOwner* owner = Gene_Owner();
 
-	auto it  = render_map->find ( duplicate.gene->cell_name );
-	if ( it == render_map->end() )
-		return _nucleus->Took_Action(duplicate.gene);
+	if ( owner && owner->Post_Action ( _action ) )
+		return;
 
-	it->second ( _nucleus, duplicate.gene, _rendon );
-	return true;
-}
+	_action->Action_Execute();
 
-//    .88888.
-//   d8'   `88
-//   88        .d8888b. 88d888b. .d8888b.
-//   88   YP88 88ooood8 88'  `88 88ooood8
-//   Y8.   .88 88.  ... 88    88 88.  ...
-//    `88888'  `88888P' dP    dP `88888P'
+	delete _action;
+}
 
-XEPL::Gene::~Gene()
+void XEPL::Gene::Owner_Call ( GeneAction* _action )
 {
-	delete space_string;
-	delete traits;
-	if ( !Test_Flags(dupe_flag) )
+	Semaphore* semaphore = new Semaphore();
 	{
-		delete inner_genes;
+		bool i_must_wait = true;
+		Rendezvous* rendezvous = new Rendezvous ( this, &semaphore, &i_must_wait );
 
-		if ( content_wire )
-			content_wire->Release();
+		_action->trigger_atom = Ref<Atom> ( rendezvous );
+
+		std::unique_lock<std::mutex> block ( *semaphore );
+		{
+			Post_To_Owner ( _action );
+
+			rendezvous->Release();
 
-		delete content_mutex;
+			while ( i_must_wait )
+				semaphore->std::condition_variable::wait ( block );
+		}
 	}
-	if(auto lobe=tlsLobe)--lobe->counters.count_genes;
+	delete semaphore;
 }
 
-XEPL::Gene::Gene ( Text* _xml )
-	: Cell ( "")
-	, content_wire    ( nullptr )
-	, traits          ( nullptr )
-	, inner_genes     ( nullptr )
-	, space_string    ( nullptr )
-	, content_mutex   ( new Mutex() )
-	, owner_link      ( nullptr )
+void XEPL::Gene::Owner_Wait ( void )
 {
-	++tlsLobe->counters.count_genes;
+	if ( Remote_Owner() )
+		Owner_Call ( new GeneAction ( this, mutate_nothing, nullptr ) );
+}
 
-	Cord text ( _xml );
-	Gene* parsed_gene = new Gene( nullptr, "text", nullptr);
+XEPL::GeneOwner::~GeneOwner ( void )
+{}
 
-	XmlParser parser ( parsed_gene, &text );
+XEPL::GeneOwner::GeneOwner ( Lobe* _lobe )
+	: Atom       ()
+	, owner_lobe ( _lobe )
+	, owner_lock ()
+{}
 
-	if ( parser.ParseIt() )
-	{
-		Gene* gene=parsed_gene->First();
+bool XEPL::GeneOwner::Post_Action ( Action* _action )
+{
+	std::lock_guard<SpinLock> lock_owner ( owner_lock );
 
-		const_cast<String*>(cell_name)->assign( *gene->cell_name );
-		
-		if ( gene->space_string )
-			space_string = new String( gene->space_string );
+	Lobe* lobe = owner_lobe.load();
+	if ( !lobe )
+		return false;
 
-		Absorb_Gene ( gene );
-	}
-	parsed_gene->Release();
+	lobe->pending_actions->Post_Action ( _action );
+	return true;
 }
 
-XEPL::Gene::Gene ( Gene* _parent, Cord* _name, Cord* _space )
-	: Cell ( _name )
-	, content_wire    ( nullptr )
-	, traits          ( nullptr )
-	, inner_genes     ( nullptr )
-	, space_string    ( _space ? new String ( _space ) : nullptr )
-	, content_mutex   ( new Mutex() )
-	, owner_link      ( _parent )
+void XEPL::GeneOwner::Lobe_Died ( void )
 {
-	if(auto lobe=tlsLobe)++lobe->counters.count_genes;
+	std::lock_guard<SpinLock> lock_owner ( owner_lock );
 
-	if ( _parent )
-	{
-		_parent->Add_Gene ( this );
-		Release();
-	}
+	owner_lobe = nullptr;
 }
 
-XEPL::Gene::Gene ( Gene* _parent, Text* _name, Cord* _space )
-	: Cell ( _name )
-	, content_wire    ( nullptr )
-	, traits          ( nullptr )
-	, inner_genes     ( nullptr )
-	, space_string    ( _space ? new String ( _space ) : nullptr )
-	, content_mutex   ( new Mutex() )
-	, owner_link      ( _parent )
+XEPL::GeneExtension::~GeneExtension ( void )
 {
-	if(auto lobe=tlsLobe)++lobe->counters.count_genes;
+	if ( GeneVersion* version = gene_version.exchange ( nullptr ) )
+		GeneVersion::Retire ( version );
 
-	if ( _parent )
-	{
-		_parent->Add_Gene ( this );
-		Release();
-	}
+	if ( GeneOwner* owner = gene_owner.exchange ( nullptr ) )
+		owner->Release();
 }
 
-XEPL::Gene::Gene ( Gene* _parent, Cord* _name )
-	: Gene( _parent, _name, nullptr )
+XEPL::GeneExtension::GeneExtension ( void )
+	: space_string   ( nullptr )
+	, lock_source    ( nullptr )
+	, content_string ()
+	, gene_version   ( nullptr )
+	, gene_owner     ( nullptr )
 {}
 
-void XEPL::Gene::Deflate_Gene ( void )
+XEPL::GeneExtension* XEPL::Gene::Extension ( void )
 {
-	MutexScope lock_Contents ( content_mutex );
-
-	if ( content_wire )
-	{
-		content_wire->Release();
-		content_wire=nullptr;
-	}
+	GeneExtension* extension = gene_extension.load();
+	if ( extension )
+		return extension;
 
-	delete traits;
-	delete inner_genes;
+	GeneExtension* made = new GeneExtension();
+	if ( gene_extension.compare_exchange_strong ( extension, made ) )
+		return made;
 
-	inner_genes = nullptr;
-	traits      = nullptr;
+	delete made;
+	return extension;
 }
 
-void XEPL::Gene::Print_Into ( String* _string, int _depth )
+XEPL::GeneVersion* XEPL::Gene::Snapshot_Version ( bool* _cached, GeneVersion** _private )
 {
-	if ( !_string )
-		return;
+	if ( GeneVersion* cached_version = Cached_Version() )
+		return cached_version;
 
-	XmlBuilder x1 ( cell_name, _string, space_string );
+	Set_Flags ( versioned_flag );
+
+	long edits = Edit_Count();
+
+	GeneVersion* version   = new GeneVersion ( this );
+	bool         cacheable = true;
+	GeneChain    unbuilt;
 
 	{
-		MutexScope lock_Contents ( content_mutex );
+		ReadScope  lock_Contents ( Read_Lock() );
 
 		if ( traits )
-			traits->Print_Into ( _string );
+			traits->Duplicate_Into ( &version->traits );
 
 		if ( content_wire )
 		{
-			x1.Close_Attributes();
+			version->has_content = true;
+			content_wire->Print_Into ( &version->content_string );
+		}
+		else if ( Test_Flags ( content_flag ) )
+		{
+			version->has_content = true;
+			version->content_string.assign ( gene_extension.load()->content_string );
+		}
 
-			content_wire->Print_Into ( _string );
+		if ( inner_genes )
+		{
+			for ( Bond* bond = inner_genes->head_bond; bond; bond = bond->next_bond )
+			{
+				Gene* gene = Genes::Atom_Of ( bond );
+
+				if ( gene->owner_link != this )
+					cacheable = false;
+				else
+					gene->Set_Flags ( embedded_flag );
+
+				GeneVersion* inner_version = gene->Cached_Version();
+				if ( !inner_version )
+					unbuilt.Add_Atom ( gene );
+
+				version->inner_versions.push_back ( inner_version );
+			}
 		}
 	}
 
-	if ( --_depth )
+	size_t slot = 0;
+	Gene*  gene = nullptr;
+	while ( unbuilt.Next ( &gene ) )
 	{
-		if ( inner_genes )
+		while ( version->inner_versions[slot] )
+			++slot;
+
+		version->inner_versions[slot] = gene->Snapshot_Version ( &cacheable, _private );
+	}
+
+	if ( cacheable && Edit_Count() == edits )
+	{
+		std::atomic<GeneVersion*>& cached = Extension()->gene_version;
+
+		GeneVersion* expected = nullptr;
+		if ( cached.compare_exchange_strong ( expected, version ) )
 		{
-			x1.Close_Attributes();
-			inner_genes->Print_Into ( _string, _depth );
+			if ( Edit_Count() == edits )
+				return version;
+
+			// a writer that took it out has retired it, after this reader pinned its epoch
+			expected = version;
+			if ( !cached.compare_exchange_strong ( expected, nullptr ) )
+			{
+				*_cached = false;
+				return version;
+			}
 		}
 	}
-}
 
+	*_cached = false;
+
+	version->retired_next = *_private;
+	*_private = version;
+
+	return version;
+}
 
 bool XEPL::Gene::Has_Content( void )
 {
-	MutexScope lock_Contents ( content_mutex );
+	ReadScope  lock_Contents ( Read_Lock() );
 
-	return !!content_wire;
+	return content_wire || Test_Flags ( content_flag );
 }
 
 bool XEPL::Gene::Copy_Content( String* _into )
 {
-	MutexScope lock_Contents ( content_mutex );
+	ReadScope  lock_Contents ( Read_Lock() );
+
+	if ( content_wire )
+	{
+		_into->append( *content_wire->wire_string );
+		return true;
+	}
 
-	if ( !content_wire )
+	if ( !Test_Flags ( content_flag ) )
 		return false;
 
-	_into->append( *content_wire->wire_string );
+	_into->append( gene_extension.load()->content_string );
 	return true;
 }
 
-XEPL::String* XEPL::Gene::Make_Content ( void )
+XEPL::Wire* XEPL::Gene::Share_Content ( void )
+{
+	if ( Remote_Owner() )
+	{
+		GeneAnswer answer {};
+		Owner_Call ( new GeneAction ( this, mutate_share, String(), String(), nullptr, &answer ) );
+		return answer.wire;
+	}
+
+	WriteScope lock_Contents ( Lock_Gene() );
+
+	if ( !content_wire && Test_Flags ( content_flag ) && !Write_Refused ( "Share_Content" ) )
+	{
+		content_wire = new Wire();
+		content_wire->wire_string->swap ( gene_extension.load()->content_string );
+		Clear_Flags ( content_flag );
+	}
+
+	return content_wire;
+}
+
+XEPL::String* XEPL::Gene::Make_Content ( void )
+{
+	if ( Remote_Owner() )
+	{
+		ErrorReport error_report ( "Make_Content refused, Gene owned by another Lobe: ", cell_name );
+		return nullptr;
+	}
+
+	WriteScope lock_Contents ( Lock_Gene() );
+
+	if ( Write_Refused ( "Make_Content" ) )
+		return nullptr;
+
+	if ( content_wire )
+		return content_wire->wire_string;
+
+	String* content = &Extension()->content_string;
+
+	Set_Flags ( content_flag );
+
+	return content;
+}
+
+void XEPL::Gene::Assign_Content ( Cord* _cord )
+{
+	if ( Remote_Owner() )
+		return Post_To_Owner ( new GeneAction ( this, mutate_assign, String(), String ( _cord ) ) );
+
+	WriteScope lock_Contents ( Lock_Gene() );
+
+	if ( Write_Refused ( "Assign_Content" ) )
+		return;
+
+	if ( content_wire )
+		return content_wire->Assign ( _cord );
+
+	String* content = &Extension()->content_string;
+
+	Set_Flags ( content_flag );
+
+	if ( _cord )
+		content->assign ( *_cord );
+}
+
+void XEPL::Gene::Assign_Content ( String&& _string )
+{
+	if ( Remote_Owner() )
+		return Post_To_Owner ( new GeneAction ( this, mutate_assign, String(), std::move ( _string ) ) );
+
+	WriteScope lock_Contents ( Lock_Gene() );
+
+	if ( Write_Refused ( "Assign_Content" ) )
+		return;
+
+	if ( content_wire )
+		return content_wire->Assign ( std::move ( _string ) );
+
+	String* content = &Extension()->content_string;
+
+	Set_Flags ( content_flag );
+
+	content->assign ( std::move ( _string ) );
+}
+
+void XEPL::Gene::Append_Content ( String&& _string )
 {
-	MutexScope lock_Contents ( content_mutex );
+	if ( Remote_Owner() )
+		return Post_To_Owner ( new GeneAction ( this, mutate_append, String(), std::move ( _string ) ) );
 
-	if ( !content_wire )
-		content_wire = new Wire();
+	WriteScope lock_Contents ( Lock_Gene() );
 
-	return content_wire->wire_string;
-}
+	if ( Write_Refused ( "Append_Content" ) )
+		return;
 
-void XEPL::Gene::Assign_Content ( Cord* _cord )
-{
-	MutexScope lock_Contents ( content_mutex );
-	
-	if ( !content_wire )
-		content_wire = new Wire();
+	if ( content_wire )
+		return content_wire->Append ( std::move ( _string ) );
+
+	String* content = &Extension()->content_string;
 
-	content_wire->Assign ( _cord );
+	Set_Flags ( content_flag );
+
+	if ( content->empty() )
+		content->assign ( std::move ( _string ) );
+	else
+		content->append ( _string );
 }
 
 void XEPL::Gene::Append_Content ( Wire* _wire )
@@ -1273,22 +3992,47 @@ void XEPL::Gene::Append_Content ( Wire* _wire )
 	if ( !_wire )
 		return;
 
-	MutexScope lock_Contents ( content_mutex );
+	if ( Remote_Owner() )
+	{
+		String term;
+		_wire->Print_Into ( &term );
+		return Post_To_Owner ( new GeneAction ( this, mutate_append, String(), std::move ( term ) ) );
+	}
 
-	if ( !content_wire )
-		content_wire = new Wire();
+	WriteScope lock_Contents ( Lock_Gene() );
+
+	if ( Write_Refused ( "Append_Content" ) )
+		return;
+
+	if ( content_wire )
+		return content_wire->Append ( _wire );
+
+	String* content = &Extension()->content_string;
 
-	content_wire->Append ( _wire );
+	Set_Flags ( content_flag );
+
+	MutexScope lock_their_wire ( _wire->wire_mutex );
+	content->append ( *_wire->wire_string );
 }
 
 void XEPL::Gene::Append_Content ( Text* _chars, long _length )
 {
-	MutexScope lock_Contents ( content_mutex );
+	if ( Remote_Owner() )
+		return Post_To_Owner ( new GeneAction ( this, mutate_append, String(), String ( _chars, _length ) ) );
 
-	if ( !content_wire )
-		content_wire = new Wire();
+	WriteScope lock_Contents ( Lock_Gene() );
+
+	if ( Write_Refused ( "Append_Content" ) )
+		return;
+
+	if ( content_wire )
+		return content_wire->Append ( _chars, _length );
+
+	String* content = &Extension()->content_string;
 
-	content_wire->Append(_chars, _length);
+	Set_Flags ( content_flag );
+
+	content->append ( _chars, _length );
 }
 
 void XEPL::Gene::Append_Content ( Cord* _cord )
@@ -1296,45 +4040,74 @@ void XEPL::Gene::Append_Content ( Cord* _cord )
 	if ( !_cord )
 		return;
 
-	MutexScope lock_Contents ( content_mutex );
+	if ( Remote_Owner() )
+		return Post_To_Owner ( new GeneAction ( this, mutate_append, String(), String ( _cord ) ) );
 
-	if ( !content_wire )
-		content_wire = new Wire();
+	WriteScope lock_Contents ( Lock_Gene() );
+
+	if ( Write_Refused ( "Append_Content" ) )
+		return;
 
-	content_wire->Append ( _cord );
+	if ( content_wire )
+		return content_wire->Append ( _cord );
+
+	String* content = &Extension()->content_string;
+
+	Set_Flags ( content_flag );
+
+	content->append ( *_cord );
 }
 
 
 XEPL::Gene* XEPL::Gene::First( void )
 {
-	MutexScope lock_Contents ( content_mutex );
+	ReadScope  lock_Contents ( Read_Lock() );
 
 	if ( inner_genes )
-		return static_cast<Gene*>( inner_genes->head_bond->atom );
+		return Genes::Atom_Of ( inner_genes->head_bond );
 
 	return nullptr;
 }
 
 XEPL::Gene* XEPL::Gene::Make_One( Text*       _chars )
 {
-	Cord tag( _chars );
+	if ( Remote_Owner() )
+	{
+		GeneAnswer answer {};
+		Owner_Call ( new GeneAction ( this, mutate_make_one, String ( _chars ), String(), nullptr, &answer ) );
+		return answer.gene;
+	}
 
-	MutexScope lock_Contents ( content_mutex );
+	WriteScope lock_Contents ( Lock_Gene() );
 
 	Gene* gene = nullptr;
-	if ( inner_genes && inner_genes->Find_Gene ( &tag, &gene ) )
+	if ( inner_genes && inner_genes->Find_Gene ( _chars, &gene ) )
 		return gene;
 
-	return new Gene ( this, &tag, nullptr );
+	if ( Write_Refused ( "Make_One" ) )
+		return nullptr;
+
+	return new Gene ( this, _chars, nullptr );
 }
 
 bool XEPL::Gene::Make_One_Gene ( Cord* _cord, Gene** _gene )
 {
-	MutexScope lock_Contents ( content_mutex );
+	if ( Remote_Owner() )
+	{
+		GeneAnswer answer {};
+		Owner_Call ( new GeneAction ( this, mutate_make_one_gene, String ( _cord ), String(), nullptr, &answer ) );
+		*_gene = answer.gene;
+		return answer.made;
+	}
+
+	WriteScope lock_Contents ( Lock_Gene() );
 
 	if ( Get_First_Gene ( _cord, _gene ) )
 		return false;
 
+	if ( Write_Refused ( "Make_One_Gene" ) )
+		return false;
+
 	*_gene = new Gene ( this, _cord, nullptr );
 
 	return true;
@@ -1347,11 +4120,26 @@ bool XEPL::Gene::Make_One_Gene ( Text*       _chars, Gene** _gene )
 		*_gene = this;
 		return false;
 	}
-	else
+
+	if ( Remote_Owner() )
 	{
-		String name ( _chars );
-		return Make_One_Gene ( &name, _gene );
+		GeneAnswer answer {};
+		Owner_Call ( new GeneAction ( this, mutate_make_one_gene, String ( _chars ), String(), nullptr, &answer ) );
+		*_gene = answer.gene;
+		return answer.made;
 	}
+
+	WriteScope lock_Contents ( Lock_Gene() );
+
+	if ( Get_First_Gene ( _chars, _gene ) )
+		return false;
+
+	if ( Write_Refused ( "Make_One_Gene" ) )
+		return false;
+
+	*_gene = new Gene ( this, _chars, nullptr );
+
+	return true;
 }
 
 void XEPL::Gene::Add_Gene ( Gene* _gene )
@@ -1359,7 +4147,16 @@ void XEPL::Gene::Add_Gene ( Gene* _gene )
 	if ( !_gene )
 		return;
 
-	MutexScope lock_Contents ( content_mutex );
+	if ( Remote_Owner() )
+		return Post_To_Owner ( new GeneAction ( this, mutate_add, _gene ) );
+
+	WriteScope lock_Contents ( Lock_Gene() );
+
+	if ( Write_Refused ( "Add_Gene" ) )
+		return;
+
+	if ( !_gene->owner_link )
+		_gene->owner_link = this;
 
 	if ( !inner_genes )
 		inner_genes = new Genes(_gene);
@@ -1373,35 +4170,35 @@ XEPL::Gene* XEPL::Gene::Get_First ( Text* _chars )
 		return nullptr;
 
 	Gene* gene = nullptr;
-	Cord name_cord( _chars );
 
-	MutexScope lock_Contents ( content_mutex );
+	ReadScope  lock_Contents ( Read_Lock() );
 
-	inner_genes->Find_Gene ( &name_cord, &gene );
+	inner_genes->Find_Gene ( _chars, &gene );
 
 	return gene;
 }
 
 bool XEPL::Gene::Get_First_Gene ( Cord* _cord, Gene** _gene )
 {
-	MutexScope lock_Contents ( content_mutex );
+	return Get_First_Gene ( std::string_view ( *_cord ), _gene );
+}
 
+bool XEPL::Gene::Get_First_Gene ( Text* _chars, Gene** _gene )
+{
 	if ( !inner_genes )
 		return false;
 
-	return inner_genes->Find_Gene ( _cord, _gene );
+	return Get_First_Gene ( std::string_view ( _chars ), _gene );
 }
 
-bool XEPL::Gene::Get_First_Gene ( Text* _chars, Gene** _gene )
+bool XEPL::Gene::Get_First_Gene ( std::string_view _name, Gene** _gene )
 {
+	ReadScope  lock_Contents ( Read_Lock() );
+
 	if ( !inner_genes )
 		return false;
-	
-	Cord name_cord( _chars );
-
-	MutexScope lock_Contents ( content_mutex );
 
-	return inner_genes->Find_Gene ( &name_cord, _gene );
+	return inner_genes->Find_Gene ( _name, _gene );
 }
 
 void XEPL::Gene::Remove_Gene ( Gene* _gene )
@@ -1409,15 +4206,19 @@ void XEPL::Gene::Remove_Gene ( Gene* _gene )
 	if ( !inner_genes || !_gene  )
 		return;
 
-	MutexScope lock_Contents ( content_mutex );
+	if ( Remote_Owner() )
+		return Post_To_Owner ( new GeneAction ( this, mutate_remove, _gene ) );
+
+	WriteScope lock_Contents ( Lock_Gene() );
+
+	if ( Write_Refused ( "Remove_Gene" ) )
+		return;
 
 	auto it  = inner_genes->bond_map->find ( _gene );
 	if ( it == inner_genes->bond_map->end() )
 		return;
 
-	Bond* bond = it->second;
-
-	inner_genes->Remove_Bond ( bond );
+	inner_genes->Remove_Bond ( it->second.gene_bond );
 
 	if ( !inner_genes->bond_map )
 	{
@@ -1428,7 +4229,17 @@ void XEPL::Gene::Remove_Gene ( Gene* _gene )
 
 bool XEPL::Gene::Replace_Gene ( Cord* _cord, Gene* _gene )
 {
-	MutexScope lock_Contents ( content_mutex );
+	if ( Remote_Owner() )
+	{
+		GeneAnswer answer {};
+		Owner_Call ( new GeneAction ( this, mutate_replace, String ( _cord ), String(), _gene, &answer ) );
+		return answer.made;
+	}
+
+	WriteScope lock_Contents ( Lock_Gene() );
+
+	if ( Write_Refused ( "Replace_Gene" ) )
+		return false;
 
 	Gene* gene = nullptr;
 
@@ -1442,20 +4253,19 @@ bool XEPL::Gene::Replace_Gene ( Cord* _cord, Gene* _gene )
 
 void XEPL::Gene::Duplicate_Gene ( Gene** _gene )
 {
-	Gene* cloned_gene = new Gene ( nullptr, cell_name, space_string );
+	Gene* cloned_gene = new Gene ( nullptr, cell_name, Space_String() );
 
-	delete cloned_gene->content_mutex;
-	cloned_gene->content_mutex  = content_mutex;
+	cloned_gene->Extension()->lock_source = Lock_Gene();
 
 	cloned_gene->owner_link     = owner_link ;
-	cloned_gene->content_wire   = content_wire;
+	cloned_gene->content_wire   = Share_Content();
 	cloned_gene->inner_genes    = inner_genes;
 
 	cloned_gene->Set_Flags( dupe_flag );
 
 	*_gene = cloned_gene;
 
-	MutexScope lock_Traits   ( content_mutex );
+	ReadScope  lock_Traits   ( Read_Lock() );
 
 	if( traits )
 		traits->Duplicate_Into ( &cloned_gene->traits );
@@ -1466,11 +4276,17 @@ void XEPL::Gene::Absorb_Gene ( Gene* _gene )
 	if ( !_gene )
 		return;
 
+	if ( Remote_Owner() )
+		return Post_To_Owner ( new GeneAction ( this, mutate_absorb, _gene ) );
+
 	if ( _gene->inner_genes )
 	{
 		StableGenes recall ( _gene );
 
-		MutexScope lock_Contents ( content_mutex );
+		WriteScope lock_Contents ( Lock_Gene() );
+
+		if ( Write_Refused ( "Absorb_Gene" ) )
+			return;
 
 		if ( !inner_genes )
 			inner_genes = new Genes ();
@@ -1480,8 +4296,9 @@ void XEPL::Gene::Absorb_Gene ( Gene* _gene )
 			inner_genes->Add_Gene ( gene );
 	}
 
-	if ( _gene->content_wire)
-		Append_Content ( _gene->content_wire );
+	String content;
+	if ( _gene->Copy_Content ( &content ) )
+		Append_Content ( std::move ( content ) );
 
 	if ( _gene->traits )
 		Absorb_Traits ( _gene );
@@ -1495,7 +4312,7 @@ void XEPL::Gene::Copy_Genes_Into ( GeneChain** _chain )
 		return;
 	}
 
-	MutexScope lock_Contents ( content_mutex );
+	ReadScope  lock_Contents ( Read_Lock() );
 
 	*_chain = new GeneChain ( inner_genes );
 }
@@ -1509,7 +4326,13 @@ void XEPL::Gene::Copy_Genes_Into ( GeneChain** _chain )
 
 void XEPL::Gene::Trait_Set ( Cord* _cord1, Cord* _cord2 )
 {
-	MutexScope lock_Traits   ( content_mutex );
+	if ( Remote_Owner() )
+		return Post_To_Owner ( new GeneAction ( this, mutate_trait, String ( _cord1 ), String ( _cord2 ) ) );
+
+	WriteScope lock_Traits   ( Lock_Gene() );
+
+	if ( Write_Refused ( "Trait_Set" ) )
+		return;
 
 	if ( !traits )
 		traits=new Traits();
@@ -1519,13 +4342,18 @@ void XEPL::Gene::Trait_Set ( Cord* _cord1, Cord* _cord2 )
 
 XEPL::Cord* XEPL::Gene::Trait_Get ( Cord* _cord, String* _string )
 {
-	MutexScope lock_Traits   ( content_mutex );
+	return Trait_Get ( std::string_view ( *_cord ), _string );
+}
+
+XEPL::Cord* XEPL::Gene::Trait_Get ( std::string_view _name, String* _string )
+{
+	ReadScope  lock_Traits   ( Read_Lock() );
 
 	if ( !traits )
 		return nullptr;
 
-	auto it  = traits->map_of_traits->find ( *_cord );
-	if ( it == traits->map_of_traits->end() )
+	auto it  = traits->map_of_traits.Find ( _name );
+	if ( it == traits->map_of_traits.end() )
 		return nullptr;
 
 	_string->assign ( * it->second->trait_term );
@@ -1534,13 +4362,18 @@ XEPL::Cord* XEPL::Gene::Trait_Get ( Cord* _cord, String* _string )
 
 XEPL::Cord* XEPL::Gene::Trait_Raw ( Cord* _cord )
 {
-	MutexScope lock_Traits   ( content_mutex );
+	return Trait_Raw ( std::string_view ( *_cord ) );
+}
+
+XEPL::Cord* XEPL::Gene::Trait_Raw ( std::string_view _name )
+{
+	ReadScope  lock_Traits   ( Read_Lock() );
 
 	if ( !traits )
 		return nullptr;
 
-	auto it  = traits->map_of_traits->find ( *_cord );
-	if ( it != traits->map_of_traits->end() )
+	auto it  = traits->map_of_traits.Find ( _name );
+	if ( it != traits->map_of_traits.end() )
 		return it->second->trait_term;
 
 	return nullptr;
@@ -1557,20 +4390,33 @@ XEPL::Text* XEPL::Gene::Trait_Default ( Text* _name_chars, Text*       _default_
 
 XEPL::Cord* XEPL::Gene::Trait_Tap ( Text* _chars, Text*       _default )
 {
-	Cord trait_name ( _chars );
+	if ( Remote_Owner() )
+	{
+		GeneAnswer answer {};
+		Owner_Call ( new GeneAction ( this, mutate_tap, String ( _chars ), String ( _default ), nullptr, &answer ) );
+		return answer.cord;
+	}
+
+	WriteScope lock_Traits   ( Lock_Gene() );
+
+	if ( traits )
+	{
+		auto it  = traits->map_of_traits.Find ( _chars );
+		if ( it != traits->map_of_traits.end() )
+			return it->second->trait_term;
+	}
 
-	MutexScope lock_Traits   ( content_mutex );
+	if ( Write_Refused ( "Trait_Tap" ) )
+		return nullptr;
 
 	if ( !traits )
 		traits=new Traits();
 
-	auto it  = traits->map_of_traits->find ( trait_name );
-	if ( it == traits->map_of_traits->end() )
-	{
-		Trait_Set ( &trait_name, _default );
-		return Trait_Raw ( &trait_name );
-	}
-	return it->second->trait_term;
+	String name ( _chars );
+	String term ( _default );
+	traits->Set_Trait ( &name, std::move ( term ) );
+
+	return traits->map_of_traits.Find ( _chars )->second->trait_term;
 }
 
 void XEPL::Gene::Absorb_Traits ( Gene* _gene )
@@ -1578,37 +4424,49 @@ void XEPL::Gene::Absorb_Traits ( Gene* _gene )
 	if ( !_gene || !_gene->traits )
 		return;
 
-	MutexScope lock_their_Traits ( _gene->content_mutex );
-	MutexScope lock_Traits       (        content_mutex );
+	if ( Remote_Owner() )
+		return Post_To_Owner ( new GeneAction ( this, mutate_absorb_traits, _gene ) );
 
-	if ( !traits )
-		traits = new Traits();
+	Traits* their_traits = nullptr;
+	if ( !_gene->Duplicate_Traits ( &their_traits ) )
+		return;
 
-	Trait* their_trait = _gene->traits->first_trait;
+	WriteScope lock_Traits   ( Lock_Gene() );
 
-	while ( their_trait )
+	if ( !Write_Refused ( "Absorb_Traits" ) )
 	{
-		traits->first_trait = new Trait ( their_trait, traits->first_trait );
-
-		traits->map_of_traits->insert_or_assign(*their_trait->trait_name, traits->first_trait);
+		if ( !traits )
+			traits = new Traits();
 
-		their_trait = their_trait->next_trait;
+		traits->Absorb ( their_traits );
 	}
+
+	delete their_traits;
 }
 
 void XEPL::Gene::Evaluate_Traits ( Nucleus* _nucleus )
 {
-	MutexScope lock_Traits   ( content_mutex );
+	Traits* evaluated = nullptr;
+	{
+		ReadScope  lock_Traits   ( Read_Lock() );
 
-	if ( !traits )
+		if ( !traits )
+			return;
+
+		traits->Scripted_Into ( &evaluated );
+	}
+
+	if ( !evaluated )
 		return;
 
-	traits->Evaluate ( this, _nucleus );
+	evaluated->Evaluate ( this, _nucleus );
+
+	delete evaluated;
 }
 
 bool XEPL::Gene::Duplicate_Traits ( Traits** _traits )
 {
-	MutexScope lock_Traits   ( content_mutex );
+	ReadScope  lock_Traits   ( Read_Lock() );
 
 	if ( !traits )
 		return false;
@@ -1620,8 +4478,7 @@ bool XEPL::Gene::Duplicate_Traits ( Traits** _traits )
 
 XEPL::Cord* XEPL::Gene::Trait_Raw ( Text* _chars )
 {
-	Cord name ( _chars );
-	return Trait_Raw ( &name );
+	return Trait_Raw ( std::string_view ( _chars ) );
 }
 
 XEPL::Cord* XEPL::Gene::Trait_Get ( Text* _chars, String* _string )
@@ -1629,8 +4486,7 @@ XEPL::Cord* XEPL::Gene::Trait_Get ( Text* _chars, String* _string )
 	if ( !traits )
 		return nullptr;
 
-	String name ( _chars );
-	return Trait_Get ( &name, _string );
+	return Trait_Get ( std::string_view ( _chars ), _string );
 }
 
 void XEPL::Gene::Trait_Set ( Text* _chars1, Text* _chars2 )
@@ -1652,6 +4508,22 @@ void XEPL::Gene::Trait_Set ( Cord* _cord, Text* _chars )
 	Trait_Set ( _cord, &val );
 }
 
+void XEPL::Gene::Trait_Set ( String&& _name, String&& _term )
+{
+	if ( Remote_Owner() )
+		return Post_To_Owner ( new GeneAction ( this, mutate_trait, std::move ( _name ), std::move ( _term ) ) );
+
+	WriteScope lock_Traits   ( Lock_Gene() );
+
+	if ( Write_Refused ( "Trait_Set" ) )
+		return;
+
+	if ( !traits )
+		traits=new Traits();
+
+	traits->Set_Trait ( &_name, std::move ( _term ) );
+}
+
 //    .88888.
 //   d8'   `88
 //   88        .d8888b. 88d888b. .d8888b. .d8888b.
@@ -1669,20 +4541,20 @@ XEPL::Genes::~Genes()
 }
 
 XEPL::Genes::Genes ()
-	: GeneChain ( this )
+	: GeneChain ()
 	, bond_map  ( nullptr )
 	, chain_map ( nullptr )
 {}
 
 XEPL::Genes::Genes ( Gene* _gene)
-	: GeneChain ( this )
+	: GeneChain ()
 	, bond_map  ( new BondMap() )
 	, chain_map ( new ChainMap() )
 {
-	Chain* chain = new Chain ( _gene );
+	ChainT<Gene, NoLock>* name_chain = new ChainT<Gene, NoLock> ( _gene );
 
-	chain_map->emplace ( *_gene->cell_name, chain              );
-	bond_map->emplace  (  _gene,            Add_Atom ( _gene ) );
+	chain_map->emplace (  _gene->cell_name, name_chain );
+	bond_map->emplace  (  _gene,            GeneBonds { Add_Atom ( _gene ), name_chain->head_bond } );
 }
 
 void XEPL::Genes::Flush ( void )
@@ -1708,27 +4580,30 @@ void XEPL::Genes::Add_Gene ( Gene* _gene )
 	auto [bond_it, bond_noob] = bond_map->try_emplace( _gene );
 	if (bond_noob)
 	{
-		bond_it->second = Add_Atom(_gene);
+		bond_it->second.gene_bond = Add_Atom(_gene);
 
-		auto [chain_it, chain_noob] = chain_map->try_emplace( *_gene->cell_name );
+		auto [chain_it, chain_noob] = chain_map->try_emplace( _gene->cell_name );
 
 		if (chain_noob)
-			chain_it->second = new Chain(_gene);
+		{
+			chain_it->second = new ChainT<Gene, NoLock>(_gene);
+			bond_it->second.name_bond = chain_it->second->head_bond;
+		}
 		else
-			chain_it->second->Add_Atom(_gene);
+			bond_it->second.name_bond = chain_it->second->Add_Atom(_gene);
 	}
 }
 
-bool XEPL::Genes::Find_Gene ( Cord* _cord, Gene** _gene )
+bool XEPL::Genes::Find_Gene ( std::string_view _name, Gene** _gene )
 {
 	if ( !chain_map )
 		return false;
 
-	auto it  = chain_map->find ( *_cord );
+	auto it  = chain_map->Find ( _name );
 	if ( it == chain_map->end() )
 		return false;
 
-	*_gene = static_cast<Gene*> ( it->second->head_bond->atom );
+	*_gene = Atom_Of ( it->second->head_bond );
 
 	return true;
 }
@@ -1738,13 +4613,26 @@ void XEPL::Genes::Remove_Bond ( Bond* _bond )
 	if ( !_bond )
 		return;
 
-	Gene* remove_gene = static_cast<Gene*> ( _bond->atom );
+	Gene* remove_gene = Atom_Of ( _bond );
+
+	if ( remove_gene->Test_Flags ( embedded_flag ) )
+	{
+		GeneLock::Hold_Link ( remove_gene );
+
+		remove_gene->Clear_Flags ( embedded_flag );
+		remove_gene->owner_link = nullptr;
+
+		GeneLock::Drop_Link ( remove_gene );
+	}
+	else
+		remove_gene->owner_link = nullptr;
 
-	remove_gene->owner_link = nullptr;
-	bond_map->erase ( _bond->atom );
+	auto bonds_it   = bond_map->find ( remove_gene );
+	Bond* name_bond = bonds_it->second.name_bond;
+	bond_map->erase ( bonds_it );
 
-	auto it  = chain_map->find ( *remove_gene->cell_name );
-	if ( it != chain_map->end() && it->second->Remove_Atom ( _bond->atom ) )
+	auto it  = chain_map->find ( remove_gene->cell_name );
+	if ( it != chain_map->end() && it->second->Remove_Bond ( name_bond ) )
 	{
 		delete it->second;
 		chain_map->erase ( it );
@@ -1775,23 +4663,14 @@ void XEPL::Genes::Print_Into ( String* _string, int _depth )
 //   Y8.   .88 88.  ... 88    88 88.  ... Y8.   .88 88    88 88.  .88 88 88    88
 //    `88888'  `88888P' dP    dP `88888P'  Y88888P' dP    dP `88888P8 dP dP    dP
 
-XEPL::GeneChain::~GeneChain()
-{
-	if ( current_gene )
-		current_gene->Release();
-
-	if ( !head_bond )
-		return;
-
-	Atom* atom = nullptr;
-
-	while ( Pull_Atom ( &atom ) )
-		atom->Release();
-}
+XEPL::GeneChain::GeneChain ( void )
+	: ChainT        ()
+	, current_gene  ()
+{}
 
-XEPL::GeneChain::GeneChain ( const Chain* _chain )
-	: Chain   ( false )
-	, current_gene  ( nullptr )
+XEPL::GeneChain::GeneChain ( const GeneChain* _chain )
+	: ChainT        ()
+	, current_gene  ()
 {
 	if ( !_chain )
 		return;
@@ -1799,8 +4678,6 @@ XEPL::GeneChain::GeneChain ( const Chain* _chain )
 	if ( !_chain->head_bond )
 		return;
 
-	MutexScope lock_chain ( _chain->chain_lock );
-
 	Bond* prev = nullptr;
 	Bond* bond = _chain->head_bond;
 
@@ -1822,19 +4699,16 @@ XEPL::GeneChain::GeneChain ( const Chain* _chain )
 
 bool XEPL::GeneChain::Next ( Gene** _gene )
 {
-	if ( current_gene )
-		current_gene->Release();
-
-	Atom* atom = nullptr;
+	Gene* gene = nullptr;
 
-	if ( head_bond && Pull_Atom ( &atom ) )
+	if ( head_bond && Pull_Atom ( &gene ) )
 	{
-		current_gene = static_cast<Gene*> ( atom );
-		*_gene = current_gene;
+		current_gene = Ref<Gene>::Adopt ( gene );
+		*_gene = current_gene.Get();
 		return true;
 	}
 
-	current_gene = nullptr;
+	current_gene = Ref<Gene>();
 	return false;
 }
 
@@ -1867,22 +4741,26 @@ XEPL::GeneScope::~GeneScope ( void )
 
 XEPL::Trait::~Trait( void )
 {
-	delete trait_name;
 	delete trait_term;
 	--tlsLobe->counters.count_traits;
 }
 
-XEPL::Trait::Trait ( Cord* _name, Cord* _term, Trait* _next_trait )
-	: next_trait ( _next_trait )
-	, trait_name ( new Cord   ( _name ) )
+XEPL::Trait::Trait ( Cord* _name, Cord* _term )
+	: trait_name ( _name )
 	, trait_term ( new String ( _term ) )
 {
 	++tlsLobe->counters.count_traits;
 }
 
-XEPL::Trait::Trait ( Trait* _trait, Trait* _next_trait )
-	: next_trait  ( _next_trait )
-	, trait_name  ( new Cord   ( _trait->trait_name ) )
+XEPL::Trait::Trait ( Cord* _name, String&& _term )
+	: trait_name ( _name )
+	, trait_term ( new String ( std::move ( _term ) ) )
+{
+	++tlsLobe->counters.count_traits;
+}
+
+XEPL::Trait::Trait ( Trait* _trait )
+	: trait_name  ( _trait->trait_name )
 	, trait_term  ( new String ( _trait->trait_term ) )
 {
 	++tlsLobe->counters.count_traits;
@@ -1909,70 +4787,101 @@ void XEPL::Trait::Print_Into ( String* _into_string )
 //
 XEPL::Traits::~Traits()
 {
-	delete map_of_traits;
-
-	Trait* trait = first_trait;
-	while ( trait )
-	{
-		Trait* next = trait->next_trait;
+	for ( auto& [_, trait] : map_of_traits )
 		delete trait;
-		trait = next;
-	}
 }
 
 XEPL::Traits::Traits()
-	: first_trait   ( nullptr )
-	, map_of_traits ( new TraitMap() )
+	: map_of_traits ()
 {}
 
 void XEPL::Traits::Set_Trait ( Cord* _name_cord, Cord* _term_cord )
 {
-	auto [it, noob] = map_of_traits->try_emplace( *_name_cord );
+	Cord* symbol = Symbols::Intern ( _name_cord );
+
+	auto [it, noob] = map_of_traits.try_emplace( symbol );
 	if (noob)
-	{
-		first_trait = new Trait(_name_cord, _term_cord, first_trait);
-		it->second = first_trait;
-	}
+		it->second = new Trait(symbol, _term_cord);
 	else
 		it->second->trait_term->assign( *_term_cord );
 }
 
+void XEPL::Traits::Set_Trait ( Cord* _name_cord, String&& _term_string )
+{
+	Cord* symbol = Symbols::Intern ( _name_cord );
+
+	auto [it, noob] = map_of_traits.try_emplace( symbol );
+	if (noob)
+		it->second = new Trait(symbol, std::move ( _term_string ));
+	else
+		it->second->trait_term->assign( std::move ( _term_string ) );
+}
+
 void XEPL::Traits::Evaluate ( Gene* _gene, Nucleus* _nucleus )
 {
-	Trait* trait = first_trait;
 	auto host = _nucleus->Host();
-	while ( trait )
+	for ( auto& [name, trait] : map_of_traits )
+	{
+		Script ( host, _gene, trait->trait_term, trait->trait_term );
+		_gene->Trait_Set ( name, trait->trait_term );
+	}
+}
+
+void XEPL::Traits::Absorb ( Traits* _traits )
+{
+	for ( auto& [name, their_trait] : _traits->map_of_traits )
 	{
+		auto [it, noob] = map_of_traits.try_emplace ( name );
+		if ( noob )
+			std::swap ( it->second, their_trait );
+		else
+			it->second->trait_term->assign ( std::move ( *their_trait->trait_term ) );
+	}
+}
+
+bool XEPL::Traits::Has_Scripts ( void )
+{
+	for ( auto& [_, trait] : map_of_traits )
 		if ( trait->trait_term->front() == '{' )
-			Script ( host, _gene, trait->trait_term, trait->trait_term );
+			return true;
+
+	return false;
+}
+
+void XEPL::Traits::Scripted_Into ( Traits** _traits )
+{
+	Traits* scripted_traits = nullptr;
 
-		trait = trait->next_trait;
+	for ( auto& [name, trait] : map_of_traits )
+	{
+		if ( trait->trait_term->front() != '{' )
+			continue;
+
+		if ( !scripted_traits )
+			scripted_traits = new Traits();
+
+		scripted_traits->map_of_traits.try_emplace ( name ).first->second = new Trait ( trait );
 	}
+
+	*_traits = scripted_traits;
 }
 
 void XEPL::Traits::Duplicate_Into ( Traits** _traits )
 {
 	Traits* clone_traits = new Traits();
-	Trait*  trait = first_trait;
 
-	while ( trait )
-	{
-		clone_traits->first_trait = new Trait ( trait, clone_traits->first_trait );
-		clone_traits->map_of_traits->emplace( *trait->trait_name, clone_traits->first_trait);
+	clone_traits->map_of_traits.reserve ( map_of_traits.size() );
+
+	for ( auto& [name, trait] : map_of_traits )
+		clone_traits->map_of_traits.try_emplace ( name ).first->second = new Trait ( trait );
 
-		trait = trait->next_trait;
-	}
 	*_traits = clone_traits;
 }
 
 void XEPL::Traits::Print_Into ( String* _string )
 {
-	Trait* trait = first_trait;
-	while ( trait )
-	{
+	for ( auto& [_, trait] : map_of_traits )
 		trait->Print_Into ( _string );
-		trait = trait->next_trait;
-	}
 }
 
 //   8888ba.88ba             dP   dP                      dP
@@ -1993,7 +4902,7 @@ XEPL::Method::Method ( Function _function, Cord* _cord, Gene* _gene )
 {
 	if ( _gene )
 	{
-		method_gene = new Gene ( nullptr, _cord, _gene->space_string );
+		method_gene = new Gene ( nullptr, _cord, _gene->Space_String() );
 		method_gene->Absorb_Gene ( _gene );
 	}
 	else
@@ -2011,7 +4920,7 @@ void XEPL::Method::Perform ( Nucleus* _nucleus, Gene* _call_gene )
 	( _nucleus->*cell_function ) ( _call_gene, method_gene );
 }
 
-class XEPL::MethodMap : public MapDeleteT<Cord, Method*> {};
+class XEPL::MethodMap : public MapDeleteT<Cord*, Method*, SymbolFlatMapT<Method*>> {};
 
 //   888888ba                    dP
 //   88    `8b                   88
@@ -2091,10 +5000,12 @@ void XEPL::Nucleus::Register_Form ( Gene* _gene )
 		return;
 
 	Gene* gene = nullptr;
-	if ( !shadows->Make_One("Forms")->Make_One_Gene ( _gene->cell_name, &gene ) )
-		gene->Deflate_Gene();
 
-	gene->Absorb_Gene ( _gene );
+	_gene->Frozen_Copy ( &gene );
+
+	shadows->Make_One("Forms")->Replace_Gene ( _gene->cell_name, gene );
+
+	gene->Release();
 }
 
 bool XEPL::Nucleus::Form_Get ( Cord* _cord, Gene** _gene )
@@ -2170,19 +5081,27 @@ void XEPL::Nucleus::Register_Method ( Cord* _name, Function _function, Gene* _ge
 	if ( !_name )
 		return;
 
+	Gene* frozen_gene = nullptr;
+
 	if ( _gene )
-		shadows->Make_One("Methods")->Add_Gene(_gene);
+	{
+		_gene->Frozen_Copy ( &frozen_gene );
+		shadows->Make_One("Methods")->Add_Gene(frozen_gene);
+	}
 
 	if ( !method_map )
 		method_map   = new MethodMap();
 
-	Method* method = new Method(_function, _name, _gene);
+	Method* method = new Method(_function, _name, frozen_gene);
 
-	auto [it,noob] = method_map->try_emplace(*_name);
+	auto [it,noob] = method_map->try_emplace( Symbols::Intern ( _name ) );
 	if ( !noob )
 		delete it->second;
 
 	it->second = method;
+
+	if ( frozen_gene )
+		frozen_gene->Release();
 }
 
 void XEPL::Nucleus::Register_Method ( Text* _name, Function _function, Gene* _gene )
@@ -2204,11 +5123,16 @@ void XEPL::Nucleus::Method_Execute ( Gene* _call_gene, Gene* _code_gene )
 }
 
 bool XEPL::Nucleus::Performed_Method ( Cord* _name_cord, Gene* _call_gene )
+{
+	return Performed_Method ( std::string_view ( *_name_cord ), _call_gene );
+}
+
+bool XEPL::Nucleus::Performed_Method ( std::string_view _name, Gene* _call_gene )
 {
 	if ( !method_map )
 		return false;
 
-	auto it  = method_map->find ( *_name_cord );
+	auto it  = method_map->Find ( _name );
 	if ( it == method_map->end() )
 		return false;
 
@@ -2218,7 +5142,7 @@ bool XEPL::Nucleus::Performed_Method ( Cord* _name_cord, Gene* _call_gene )
 		if ( _call_gene)
 			_call_gene->Print_Into(&trace_string, 1);
 		else
-			trace_string.assign(*_name_cord);
+			trace_string.assign(_name);
 		TRACE( "ENTR_Method", Host(), &trace_string );
 	}
 
@@ -2229,8 +5153,7 @@ bool XEPL::Nucleus::Performed_Method ( Cord* _name_cord, Gene* _call_gene )
 
 bool XEPL::Nucleus::Performed_Method ( Text* _chars, Gene* _gene )
 {
-	Cord name_cord ( _chars );
-	return Performed_Method ( &name_cord, _gene );
+	return Performed_Method ( std::string_view ( _chars ), _gene );
 }
 
 
@@ -2284,7 +5207,7 @@ void XEPL::Nucleus::Process_Inner_Genes ( Gene* _gene )
 
 	while ( gene_bond )
 	{
-		Gene* gene = static_cast<Gene*>(gene_bond->atom );
+		Gene* gene = Genes::Atom_Of ( gene_bond );
 		
 		bool processed = false;
 		if ( gene->traits )
@@ -2303,10 +5226,15 @@ void XEPL::Nucleus::Process_Inner_Genes ( Gene* _gene )
 }
 
 bool XEPL::Nucleus::Process_Exact_Gene ( Cord* _cord, Gene* _host_gene )
+{
+	return Process_Exact_Gene ( std::string_view ( *_cord ), _host_gene );
+}
+
+bool XEPL::Nucleus::Process_Exact_Gene ( std::string_view _name, Gene* _host_gene )
 {
 	Gene* matching_gene = nullptr;
 
-	if ( !_host_gene->Get_First_Gene ( _cord, &matching_gene ) )
+	if ( !_host_gene->Get_First_Gene ( _name, &matching_gene ) )
 		return false;
 
 	Script ( Host(), matching_gene );
@@ -2319,8 +5247,7 @@ bool XEPL::Nucleus::Process_Exact_Gene ( Cord* _cord, Gene* _host_gene )
 
 bool XEPL::Nucleus::Process_Exact_Gene ( Text* _chars, Gene* _host_gene )
 {
-	Cord name_cord ( _chars );
-	return Process_Exact_Gene ( &name_cord, _host_gene );
+	return Process_Exact_Gene ( std::string_view ( _chars ), _host_gene );
 }
 
 //   888888ba
@@ -2345,6 +5272,7 @@ XEPL::Neuron::Neuron ( Text* _name )
 	, relay_map       ( nullptr )
 	, neuron_map      ( nullptr )
 	, neuron_chain    ( nullptr )
+	, neuron_bond     ( nullptr )
 	, alias           ( nullptr )
 {
 	if(auto lobe=tlsLobe)++lobe->counters.count_neurons;
@@ -2359,6 +5287,7 @@ XEPL::Neuron::Neuron ( Neuron*  _parent_neuron, Gene* _config_gene )
 	, relay_map       ( nullptr )
 	, neuron_map      ( nullptr )
 	, neuron_chain    ( nullptr )
+	, neuron_bond     ( nullptr )
 	, alias           ( nullptr )
 {
 	++tlsLobe->counters.count_neurons;
@@ -2420,20 +5349,25 @@ void XEPL::Neuron::Method_Terminate ( Gene*, Gene* )
 
 bool XEPL::Neuron::Feature_Get ( Cord* _feature_cord, String* _build_string )
 {
-	if ( _feature_cord->empty() )
+	return Feature_Get ( std::string_view ( *_feature_cord ), _build_string );
+}
+
+bool XEPL::Neuron::Feature_Get ( std::string_view _feature, String* _build_string )
+{
+	if ( _feature.empty() )
 	{
 		_build_string->append(*Host()->cell_name);
 		return true;
 	}
 	
-	if ( _feature_cord->compare ( "path" ) == 0 )
+	if ( _feature.compare ( "path" ) == 0 )
 	{
 		_build_string->push_back ( '/' );
 		Nucleus_Path ( _build_string, '/' );
 		return true;
 	}
 
-	if ( _feature_cord->compare( "neurons" ) == 0 )
+	if ( _feature.compare( "neurons" ) == 0 )
 	{
 		XmlBuilder builder( "neurons", _build_string );
 		builder.Close_Attributes();
@@ -2446,21 +5380,24 @@ bool XEPL::Neuron::Feature_Get ( Cord* _feature_cord, String* _build_string )
 
 bool XEPL::Neuron::Feature_Get ( Text* _chars, String* _string )
 {
-	Cord feature_cord ( _chars );
-	return Feature_Get ( &feature_cord, _string );
+	return Feature_Get ( std::string_view ( _chars ), _string );
 }
 
 
 
 bool XEPL::Neuron::Drop_Neuron(Text* _chars )
 {
-	Cord name_cord(_chars);
-	return Drop_Neuron( &name_cord );
+	return Drop_Neuron( std::string_view ( _chars ) );
 }
 
 bool XEPL::Neuron::Drop_Neuron ( Cord* _cord )
 {
-	auto it  = neuron_map->find ( *_cord );
+	return Drop_Neuron ( std::string_view ( *_cord ) );
+}
+
+bool XEPL::Neuron::Drop_Neuron ( std::string_view _name )
+{
+	auto it  = neuron_map->Find ( _name );
 	if ( it == neuron_map->end() )
 		return false;
 
@@ -2473,8 +5410,16 @@ void XEPL::Neuron::Drop_My_Neurons()
 {
 	if ( neuron_chain )
 	{
-		while ( Neuron* neuron = neuron_chain->Last() )
-			neuron->Nucleus_Dropped();
+		while ( Bond* bond = neuron_chain->Detach_Neurons() )
+		{
+			while ( bond )
+			{
+				Bond* prev_bond = bond->prev_bond;
+				NeuronChain::Atom_Of ( bond )->Nucleus_Dropped();
+				delete bond;
+				bond = prev_bond;
+			}
+		}
 	}
 	delete neuron_chain;
 	delete neuron_map;
@@ -2493,11 +5438,11 @@ void XEPL::Neuron::Register_Neuron ( Neuron* _neuron )
 		neuron_chain = new NeuronChain();
 		neuron_map   = new NeuronMap();
 	}
-	MutexScope lock_chain( neuron_chain->chain_lock );
+	MutexScope lock_chain( &neuron_chain->chain_lock );
 
-	neuron_chain->Add_Atom ( _neuron );
+	_neuron->neuron_bond = neuron_chain->Add_Atom ( _neuron );
 
-	auto [it, noob] = neuron_map->try_emplace ( *neuron_name );
+	auto [it, noob] = neuron_map->try_emplace ( neuron_name );
 	if ( !noob )
 	{
 		it->second->Release();
@@ -2512,22 +5457,25 @@ void XEPL::Neuron::Unregister_Neuron ( Neuron* _neuron )
 
 	if ( neuron_chain )
 	{
-		MutexScope lock_chain( neuron_chain->chain_lock );
+		MutexScope lock_chain( &neuron_chain->chain_lock );
 
-		auto it  = neuron_map->find ( *_neuron->cell_name );
+		auto it  = neuron_map->find ( _neuron->cell_name );
 		if ( it != neuron_map->end() )
-		{
 			neuron_map->erase ( it );
-			neuron_chain->Remove_Atom ( _neuron );
+
+		if ( _neuron->neuron_bond )
+		{
+			neuron_chain->Remove_Bond ( _neuron->neuron_bond );
+			_neuron->neuron_bond = nullptr;
 		}
 	}
 }
 
-bool XEPL::Neuron::Get_Neuron ( Cord* _cord, Neuron** _neuron )
+bool XEPL::Neuron::Get_Neuron ( std::string_view _name, Neuron** _neuron )
 {
-	MutexScope lock_chain( neuron_chain->chain_lock );
+	MutexScope lock_chain( &neuron_chain->chain_lock );
 
-	auto it  = neuron_map->find ( *_cord );
+	auto it  = neuron_map->Find ( _name );
 	if ( it == neuron_map->end() )
 		return false;
 
@@ -2536,46 +5484,56 @@ bool XEPL::Neuron::Get_Neuron ( Cord* _cord, Neuron** _neuron )
 	return true;
 }
 
-bool XEPL::Neuron::Hunt_Neuron ( Cord* _cord, Neuron** _neuron )
+bool XEPL::Neuron::Hunt_Neuron ( std::string_view _name, Neuron** _neuron )
 {
-	if ( _cord->compare( *cell_name ) == 0 )
+	if ( _name.compare( *cell_name ) == 0 )
 	{
 		*_neuron = this;
 		return true;
 	}
 
-	if ( neuron_map && Get_Neuron ( _cord, _neuron ) )
+	if ( neuron_map && Get_Neuron ( _name, _neuron ) )
 		return true;
 
-	if ( alias && ( _cord->compare( *alias ) == 0 ) )
+	if ( alias && ( _name.compare( *alias ) == 0 ) )
 	{
 		*_neuron = this;
 		return true;
 	}
 
 	if ( parent_neuron )
-		return parent_neuron->Hunt_Neuron ( _cord, _neuron );
+		return parent_neuron->Hunt_Neuron ( _name, _neuron );
 
 	return false;
 }
 
 bool XEPL::Neuron::Find_Neuron ( Cord* _cord, Neuron** _neuron  )
 {
-	if ( _cord->empty() )
+	return Find_Neuron ( std::string_view ( *_cord ), _neuron );
+}
+
+bool XEPL::Neuron::Find_Neuron ( Text* _chars, Neuron** _neuron  )
+{
+	return Find_Neuron ( std::string_view ( _chars ), _neuron );
+}
+
+bool XEPL::Neuron::Find_Neuron ( std::string_view _name, Neuron** _neuron  )
+{
+	if ( _name.empty() )
 	{
 		*_neuron = cortex->host_lobe;
 		return false;
 	}
-	if ( Hunt_Neuron ( _cord, _neuron ) )
+	if ( Hunt_Neuron ( _name, _neuron ) )
 	{
 		return true;
 	}
-	if ( _cord->compare("this") == 0 )
+	if ( _name.compare("this") == 0 )
 	{
 		*_neuron = this;
 		return true;
 	}
-	if ( _cord->compare("parent") == 0 )
+	if ( _name.compare("parent") == 0 )
 	{
 		*_neuron = parent_neuron;
 		return true;
@@ -2584,20 +5542,23 @@ bool XEPL::Neuron::Find_Neuron ( Cord* _cord, Neuron** _neuron  )
 	return false;
 }
 
-bool XEPL::Neuron::Find_Neuron ( Text* _chars, Neuron** _neuron  )
-{
-	String name ( _chars );
-	return Find_Neuron ( &name, _neuron );
-}
-
 void XEPL::Neuron::Show_Neurons( String* _string )
 {
 	if ( !neuron_map )
 		return;
 
-	MutexScope lock_chain( neuron_chain->chain_lock );
+	MutexScope lock_chain( &neuron_chain->chain_lock );
 
+	std::vector<Neuron*, TAllocatorT<Neuron*>> by_name;
 	for ( auto& [_, inner_neuron] : *neuron_map )
+		by_name.push_back ( inner_neuron );
+
+	std::sort ( by_name.begin(), by_name.end(), [] ( Neuron* _left, Neuron* _right )
+	{
+		return *_left->cell_name < *_right->cell_name;
+	} );
+
+	for ( Neuron* inner_neuron : by_name )
 	{
 		XmlBuilder x1(inner_neuron->cell_name->c_str(), _string);
 		x1.Close_Attributes();
@@ -2615,7 +5576,7 @@ void XEPL::Neuron::Drop_My_Axons()
 		return;
 
 	{
-		MutexScope lock_chain ( axon_chain->chain_lock );
+		MutexScope lock_chain ( &axon_chain->chain_lock );
 		axon_chain->Cancel_All_Receptors();
 	}
 	delete axon_chain;
@@ -2631,11 +5592,11 @@ void XEPL::Neuron::Register_Axon ( Axon* _axon )
 		axon_chain = new AxonChain ();
 		axon_map   = new AxonMap();
 	}
-	MutexScope lock_chain ( axon_chain->chain_lock );
+	MutexScope lock_chain ( &axon_chain->chain_lock );
 
-	axon_chain->Add_Atom ( _axon );
+	_axon->axon_bond = axon_chain->Add_Atom ( _axon );
 
-	auto [it, noob] = axon_map->insert_or_assign( *_axon->axon_name, _axon);
+	auto [it, noob] = axon_map->insert_or_assign( _axon->axon_name, _axon);
 	if (!noob)
 		ErrorReport error_report("Replaced axon: ", _axon->axon_name );
 
@@ -2646,13 +5607,16 @@ void XEPL::Neuron::Unregister_Axon ( Axon* _axon )
 {
 	if ( axon_chain )
 	{
-		MutexScope lock_chain ( axon_chain->chain_lock );
+		MutexScope lock_chain ( &axon_chain->chain_lock );
 
-		auto it  = axon_map->find ( *_axon->axon_name );
+		auto it  = axon_map->find ( _axon->axon_name );
 		if ( it != axon_map->end() )
-		{
 			axon_map->erase ( it );
-			axon_chain->Remove_Atom( _axon );
+
+		if ( _axon->axon_bond )
+		{
+			axon_chain->Remove_Bond ( _axon->axon_bond );
+			_axon->axon_bond = nullptr;
 		}
 	}
 }
@@ -2662,9 +5626,9 @@ bool XEPL::Neuron::Get_Axon ( Cord* _cord, Axon** _axon )
 	if ( !axon_chain )
 		return false;
 
-	MutexScope lock_chain ( axon_chain->chain_lock );
+	MutexScope lock_chain ( &axon_chain->chain_lock );
 
-	auto it  = axon_map->find ( *_cord );
+	auto it  = axon_map->Find ( _cord );
 	if ( it == axon_map->end() )
 		return false;
 
@@ -2703,7 +5667,7 @@ void XEPL::Neuron::Drop_My_Receptors()
 {
 	if ( receptor_chain )
 	{
-		MutexScope lock_chain( receptor_chain->chain_lock );
+		MutexScope lock_chain( &receptor_chain->chain_lock );
 
 		receptor_chain->Disconnect_Receptors();
 	}
@@ -2713,13 +5677,26 @@ void XEPL::Neuron::Drop_My_Receptors()
 
 void XEPL::Neuron::Disconnect_Receptor ( Receptor* _receptor )
 {
-	receptor_chain->Remove_Atom ( _receptor );
+	if ( _receptor->receptor_bond )
+	{
+		receptor_chain->Remove_Bond ( _receptor->receptor_bond );
+		_receptor->receptor_bond = nullptr;
+	}
 
 	const auto it = relay_map->find ( _receptor->signal_axon );
 
 	Relay* relay = it->second;
 
-	if ( relay->receptor_chain->Remove_Atom ( _receptor ) )
+	bool relay_is_empty;
+	if ( relay != _receptor && _receptor->relay_bond )
+	{
+		relay_is_empty = relay->receptor_chain->Remove_Bond ( _receptor->relay_bond );
+		_receptor->relay_bond = nullptr;
+	}
+	else
+		relay_is_empty = relay->receptor_chain->Remove_Atom ( _receptor );
+
+	if ( relay_is_empty )
 	{
 		relay_map->erase ( it );
 		if ( relay_map->empty() )
@@ -2742,7 +5719,7 @@ void XEPL::Neuron::Connect_Receptor ( Axon* _axon, Receptor* _receptor )
 	if ( noob )
 		Neuron_Axon_Relay ( _axon, _receptor, &it->second );
 
-	it->second->receptor_chain->Add_Atom ( _receptor );
+	_receptor->relay_bond = it->second->receptor_chain->Add_Atom ( _receptor );
 }
 
 void XEPL::Neuron::Synapse_Axon ( Axon* _axon, Receiver _receiver, Cell* _cell )
@@ -2754,7 +5731,7 @@ void XEPL::Neuron::Synapse_Axon ( Axon* _axon, Receiver _receiver, Cell* _cell )
 
 	Receptor* receptor = new Receptor ( this, _axon, _receiver, _cell );
 	Connect_Receptor ( _axon, receptor );
-	receptor_chain->Add_Atom ( receptor );
+	receptor->receptor_bond = receptor_chain->Add_Atom ( receptor );
 }
 
 
@@ -2774,7 +5751,11 @@ void XEPL::Neuron::Disconnect_Relay ( Relay* _relay )
 
 	Relay* parent_relay = it->second;
 
-	if ( parent_relay->receptor_chain->Remove_Atom ( _relay ) )
+	Bond* relay_bond   = _relay->relay_bond;
+	_relay->relay_bond = nullptr;
+
+	if ( relay_bond ? parent_relay->receptor_chain->Remove_Bond ( relay_bond )
+	                : parent_relay->receptor_chain->Remove_Atom ( _relay ) )
 	{
 		relay_map->erase ( it );
 		if ( relay_map->empty() )
@@ -2799,11 +5780,14 @@ void XEPL::Neuron::Register_Macro ( Cord* _name, String* _macro )
 	if ( !_name )
 		return;
 
-	Gene* gene = nullptr;
-	if ( !shadows->Make_One("Macros")->Make_One_Gene ( _name, &gene ) )
-		gene->Deflate_Gene();
+	Gene* gene = new Gene ( nullptr, _name, nullptr );
 
 	gene->Assign_Content ( _macro );
+	gene->Freeze();
+
+	shadows->Make_One("Macros")->Replace_Gene ( _name, gene );
+
+	gene->Release();
 }
 
 bool XEPL::Neuron::Macro_Hunt ( Cord* _cord, String* _string )
@@ -2846,14 +5830,19 @@ bool XEPL::Neuron::Performed_Macro ( Cord* _opcode, Cord* _seed, String* _param,
 
 
 XEPL::NeuronChain::NeuronChain( )
-: Chain ( true )
+: ChainT ()
 {}
 
-XEPL::Neuron* XEPL::NeuronChain::Last ( void )
+XEPL::Bond* XEPL::NeuronChain::Detach_Neurons ( void )
 {
-	if ( tail_bond )
-		return static_cast<Neuron*> ( tail_bond->atom );
-	return nullptr;
+	MutexScope lock_chain ( &chain_lock );
+
+	Bond* last_bond = tail_bond;
+
+	for ( Bond* bond = Detach_Bonds(); bond; bond = bond->next_bond )
+		Atom_Of ( bond )->neuron_bond = nullptr;
+
+	return last_bond;
 }
 
 //    888888ba                          dP
@@ -2902,7 +5891,7 @@ void XEPL::Rendon::Generate_Payload ( Nucleus* _nucleus, Gene* _gene )
 	Bond* bond = _gene->inner_genes->head_bond;
 	while ( bond )
 	{
-		Gene* gene =  static_cast<Gene*> ( bond->atom );
+		Gene* gene =  Genes::Atom_Of ( bond );
 		Markup ( _nucleus, gene, rendition );
 		bond = bond->next_bond ;
 	}
@@ -2916,7 +5905,7 @@ void XEPL::Rendon::Markup ( Nucleus* _nucleus, Gene* _gene, String* _string )
 	if ( Show_Trace )
 		ErrorReport error_report( "renderer missed tag: ", _gene->cell_name );
 
-	XmlBuilder x1 ( _gene->cell_name, _string, _gene->space_string );
+	XmlBuilder x1 ( _gene->cell_name, _string, _gene->Space_String() );
 	if ( _gene->traits )
 		x1.Absorb_Traits ( _nucleus, _gene );
 	x1.Close_Attributes();
@@ -2931,7 +5920,7 @@ void XEPL::Rendon::Markup ( Nucleus* _nucleus, Gene* _gene, String* _string )
 	Bond* bond = _gene->inner_genes->head_bond;
 	while ( bond )
 	{
-		Markup ( _nucleus, static_cast<Gene*> ( bond->atom ), rendition );
+		Markup ( _nucleus, Genes::Atom_Of ( bond ), rendition );
 		bond = bond->next_bond ;
 	}
 }
@@ -2976,7 +5965,7 @@ void XEPL::Senson::Method_Senson_Received ( Gene*, Gene* )
 
 	if ( trigger  )
 	{
-		senson_wire->Append ( trigger->content_wire );
+		senson_wire->Append ( trigger->Share_Content() );
 		Senson_Scan();
 	}
 }
@@ -2999,6 +5988,11 @@ XEPL::Lobe::~Lobe()
 		locals->Release();
 
 	delete ephemerals;
+	delete refused_genes;
+
+	gene_owner->Lobe_Died();
+	gene_owner->Release();
+
 	delete pending_actions;
 	delete rest_semaphore;
 	delete cpp_thread;
@@ -3016,11 +6010,15 @@ XEPL::Lobe::Lobe ( Text* _chars )
 	, locals           ( nullptr )
 	, ephemerals       ( nullptr )
 	, short_terms      ( nullptr )
+	, refused_genes    ( nullptr )
+	, gene_owner       ( new GeneOwner ( this ) )
 	, parent_lobe      ( nullptr )
 	, active_rendon    ( nullptr )
 	, trigger_atom     ( nullptr )
 	, output_string    ( nullptr )
 	, counters         ()
+	, scratch_arena    ()
+	, trim_decay       ( Memory::trimDecay )
 {
 	if(auto lobe=tlsLobe)++lobe->counters.count_lobes;
 
@@ -3037,11 +6035,15 @@ XEPL::Lobe::Lobe ( Neuron* _parent_neuron, Gene* _config_gene )
 	, locals          ( nullptr )
 	, ephemerals      ( nullptr )
 	, short_terms     ( nullptr )
+	, refused_genes   ( nullptr )
+	, gene_owner      ( new GeneOwner ( this ) )
 	, parent_lobe     ( tlsLobe )
 	, active_rendon   ( nullptr )
 	, trigger_atom    ( nullptr )
 	, output_string   ( nullptr )
 	, counters        ()
+	, scratch_arena   ()
+	, trim_decay      ( Memory::trimDecay )
 {
 	if ( _config_gene )
 	{
@@ -3138,10 +6140,15 @@ bool XEPL::Lobe::Dispatch_Action ( void )
 
 	++tlsLobe->counters.count_dispatched;
 
+	tlsScratch = &scratch_arena;
+
 	action->Action_Execute();
 
 	delete action;
 
+	if ( pending_actions->budget_bytes )
+		pending_actions->Publish_Heap ( Recycler::Heap_Bytes() );
+
 	return true;
 }
 
@@ -3153,10 +6160,17 @@ void XEPL::Lobe::Close_Dispatch()
 	if ( ephemerals )
 		delete ephemerals;
 
+	if ( refused_genes )
+		delete refused_genes;
+
 	index_link->Deflate_Gene();
 
-	ephemerals = nullptr;
-	locals     = nullptr;
+	ephemerals    = nullptr;
+	locals        = nullptr;
+	refused_genes = nullptr;
+
+	scratch_arena.Reset();
+	tlsScratch = nullptr;
 }
 
 void XEPL::Lobe::Lobe_Born ( void )
@@ -3178,16 +6192,16 @@ void XEPL::Lobe::Lobe_Dying ( void )
 
 void XEPL::Lobe::Lobe_Rest_Now ( void )
 {
+	if ( trim_decay )
+		Recycler::Trim_Heap ( trim_decay );
+
 	std::unique_lock<std::mutex> lock ( *cpp_thread->semaphore_rest );
-	{
-		MutexScope lock_actions ( pending_actions->actions_lock );
 
-		if ( pending_actions->head_action != nullptr )
-			return;
+	if ( pending_actions->tail_action.load() != nullptr )
+		return;
 
-		if ( pending_actions->list_is_closed )
-			return;
-	}
+	if ( pending_actions->list_is_closed )
+		return;
 
 	++counters.count_rests;
 
@@ -3203,12 +6217,40 @@ void XEPL::Lobe::Main_Loop ( Semaphore* _semaphore )
 		Nucleus_Path ( &neuron_path_string, '/' );
 		Set_Thread_Name ( cpp_thread, neuron_path_string.c_str() );
 	}
+
+	if ( Gene* config_gene = shadows->Get_First ( "config" ) )
+	{
+		String slab_pages;
+		if ( config_gene->Trait_Get ( "slab_pages", &slab_pages ) )
+			Recycler::Prewarm_Heap ( Into_Long ( &slab_pages ) );
+
+		String decay_rests;
+		if ( config_gene->Trait_Get ( "trim_decay", &decay_rests ) )
+			trim_decay = std::max ( 0L, Into_Long ( &decay_rests ) );
+
+		String budget;
+		if ( config_gene->Trait_Get ( "budget", &budget ) )
+		{
+			String policy;
+			config_gene->Trait_Get ( "budget_policy", &policy );
+
+			if ( !policy.compare ( "fail" ) )
+				pending_actions->Set_Budget ( Into_Long ( &budget ), budget_fail );
+			else if ( !policy.compare ( "spill" ) )
+				pending_actions->Set_Budget ( Into_Long ( &budget ), budget_spill );
+			else
+				pending_actions->Set_Budget ( Into_Long ( &budget ), budget_block );
+		}
+	}
+
 	this->Attach();
 
 	Gene* index = new Gene ( nullptr, "Index", cell_name );
 
 	ScopeIndex stack( index );
 
+	observer->Own ( this );
+
 	Lobe_Born();
 
 	_semaphore->Give();
@@ -3220,6 +6262,15 @@ void XEPL::Lobe::Main_Loop ( Semaphore* _semaphore )
 		while ( !Test_Flags( lysing_flag ) && Dispatch_Action() )
 			Close_Dispatch();
 
+		Recycler::Reclaim_Heap();
+		OwnerBias::Merge_Queued();
+
+		if ( pending_actions->budget_bytes )
+		{
+			pending_actions->Publish_Heap ( Recycler::Heap_Bytes() );
+			pending_actions->Report_Budget ( observer->Make_One ( "Budget" ) );
+		}
+
 		if ( XEPL::Show_Counters )
 		{
 			scratch.clear();
@@ -3227,9 +6278,13 @@ void XEPL::Lobe::Main_Loop ( Semaphore* _semaphore )
 			observer->Make_One("Counters")->Assign_Content(&scratch);
 		}
 
+		if ( XEPL::Show_Memory_Profile )
+			Recycler::Profile_Heap ( observer->Make_One("Heap") );
+
 		if ( XEPL::Show_Memory_Counts )
 		{
 			scratch.clear();
+			scratch_arena.Report( &scratch );
 			Recycler::Report_Heap( &scratch );
 			observer->Make_One("Heap")->Assign_Content(&scratch);
 		}
@@ -3240,6 +6295,8 @@ void XEPL::Lobe::Main_Loop ( Semaphore* _semaphore )
 
 	Lobe_Dying();
 
+	gene_owner->Lobe_Died();
+
 	index->Release();
 }
 
@@ -3248,12 +6305,16 @@ void XEPL::Lobe::Main_Loop ( Semaphore* _semaphore )
 void XEPL::Lobe::Neuron_Axon_Relay ( Axon* _axon, Receptor* _receptor, Relay** _relay )
 {
 	*_relay = new class Synapse ( this, _axon, ( Receiver )&Lobe::Relay_Nop, _receptor );
-	_axon->receptor_chain->Add_Atom ( *_relay );
+	( *_relay )->relay_bond = _axon->receptor_chain->Add_Atom ( *_relay );
 }
 
 void XEPL::Lobe::Neuron_Drop_Relay ( Relay* _relay )
 {
-	_relay->signal_axon->receptor_chain->Remove_Atom ( _relay );
+	if ( _relay->relay_bond )
+	{
+		_relay->signal_axon->receptor_chain->Remove_Bond ( _relay->relay_bond );
+		_relay->relay_bond = nullptr;
+	}
 	_relay->Release();
 }
 
@@ -3267,23 +6328,24 @@ void XEPL::Lobe::Neuron_Drop_Relay ( Relay* _relay )
 XEPL::Axon::~Axon()
 {
 	delete receptor_chain;
-	delete axon_name;
 }
 
 XEPL::Axon::Axon ( Neuron* _owner, Text* _name )
 	: Atom()
-	, axon_name       ( new Cord( _name ) )
+	, axon_name       ( Symbols::Intern ( _name ) )
 	, host_neuron     ( _owner )
 	, receptor_chain  ( new ReceptorChain() )
+	, axon_bond       ( nullptr )
 {
 	host_neuron->Register_Axon ( this );
 }
 
 XEPL::Axon::Axon ( Neuron* _owner, Cord* _name )
 	: Atom()
-	, axon_name       ( new Cord( _name ) )
+	, axon_name       ( Symbols::Intern ( _name ) )
 	, host_neuron     ( _owner )
 	, receptor_chain  ( new ReceptorChain() )
+	, axon_bond       ( nullptr )
 {
 	host_neuron->Register_Axon ( this );
 }
@@ -3326,7 +6388,7 @@ void XEPL::Axon::Trigger_Wait ( Atom* _atom )
 
 			rendezvous->Release();
 
-			if ( i_must_wait )
+			while ( i_must_wait )
 				semaphore->std::condition_variable::wait ( block );
 		}
 	}
@@ -3342,13 +6404,13 @@ void XEPL::Axon::Trigger_Wait ( Atom* _atom )
 //   88     88  dP'  `dP `88888P' dP    dP  Y88888P' dP    dP `88888P8 dP dP    dP
 
 XEPL::AxonChain::AxonChain ( void )
-	: Chain ( true )
+	: ChainT ()
 {}
 
 void XEPL::AxonChain::Cancel_All_Receptors()
 {
 	while ( head_bond  )
-		static_cast<Axon*> ( head_bond->atom )->Cancel_Receptors();
+		Atom_Of ( head_bond )->Cancel_Receptors();
 }
 
 //    888888ba                                        dP
@@ -3378,6 +6440,8 @@ XEPL::Receptor::Receptor ( Neuron* _neuron, Axon* _axon, Receiver _receiver, Ato
 	, signal_axon       ( _axon )
 	, signal_receiver   ( _receiver )
 	, memento_atom      ( _atom )
+	, receptor_bond     ( nullptr )
+	, relay_bond        ( nullptr )
 {
 	if ( signal_axon )
 		signal_axon->Attach();
@@ -3406,7 +6470,7 @@ void XEPL::Receptor::Receptor_Activate ( Atom* _trigger_atom ) const
 
 
 XEPL::ReceptorChain::ReceptorChain ()
-	:  Chain ( true )
+	:  ChainT ()
 {}
 
 void XEPL::ReceptorChain::Deliver_Signal ( Atom* _atom )
@@ -3414,7 +6478,7 @@ void XEPL::ReceptorChain::Deliver_Signal ( Atom* _atom )
 	Bond* my_bonds;
 	Bond* copy_bond;
 	{
-		MutexScope lock_synapse ( chain_lock );
+		MutexScope lock_synapse ( &chain_lock );
 
 		if ( !head_bond )
 			return;
@@ -3433,7 +6497,7 @@ void XEPL::ReceptorChain::Deliver_Signal ( Atom* _atom )
 	while ( my_bonds )
 	{
 		copy_bond = my_bonds;
-		static_cast<Receptor*> ( copy_bond->atom )->Receptor_Activate ( _atom ) ;
+		Atom_Of ( copy_bond )->Receptor_Activate ( _atom ) ;
 		my_bonds = copy_bond->next_bond;
 		delete copy_bond;
 	}
@@ -3441,10 +6505,10 @@ void XEPL::ReceptorChain::Deliver_Signal ( Atom* _atom )
 
 void XEPL::ReceptorChain::Disconnect_Receptors()
 {
-	MutexScope lock_chain (chain_lock);
+	MutexScope lock_chain ( &chain_lock );
 
 	while ( head_bond )
-		static_cast<Receptor*> ( head_bond->atom )->Receptor_Cancel();
+		Atom_Of ( head_bond )->Receptor_Cancel();
 }
 
 //    888888ba           dP
@@ -3487,10 +6551,13 @@ XEPL::Synapse::Synapse ( Lobe* _lobe, Axon* _axon, Receiver _receiver, Receptor*
 
 void XEPL::Synapse::Receptor_Activate ( Atom* _atom ) const
 {
+	if ( !action_list->Admit_Post() )
+		return;
+
 	Bond* my_bonds;
 	Bond* copy_bond;
 	{
-		MutexScope lock_synapse (  receptor_chain->chain_lock );
+		MutexScope lock_synapse (  &receptor_chain->chain_lock );
 
 		if ( ! receptor_chain->head_bond )
 			return;
@@ -3509,8 +6576,8 @@ void XEPL::Synapse::Receptor_Activate ( Atom* _atom ) const
 	while ( my_bonds )
 	{
 		copy_bond = my_bonds;
-		Receptor* receptor = static_cast<Receptor*> ( copy_bond->atom );
-		action_list->Post_Action( new SignalAction ( receptor, _atom ) );
+		auto receptor = Ref<Receptor>::Adopt ( static_cast<Receptor*> ( copy_bond->Unbind() ) );
+		action_list->Post_Action( new SignalAction ( std::move ( receptor ), _atom ) );
 		my_bonds = my_bonds->next_bond;
 		delete copy_bond;
 	}
@@ -3526,18 +6593,12 @@ void XEPL::Synapse::Receptor_Activate ( Atom* _atom ) const
 //             dP
 
 XEPL::Spike::~Spike()
-{
-	if ( stimulus )
-		stimulus->Release();
-}
+{}
 
 XEPL::Spike::Spike ( Atom* _stimulus )
 	: Atom()
 	, stimulus ( _stimulus )
-{
-	if ( stimulus )
-		stimulus->Attach();
-}
+{}
 
 //    888888ba                          dP
 //    88    `8b                         88
@@ -3549,7 +6610,12 @@ XEPL::Spike::Spike ( Atom* _stimulus )
 XEPL::Rendezvous::~Rendezvous()
 {
 	if ( lobe != tlsLobe )
-		(*semaphore)->Give();
+	{
+		Semaphore* waiting = *semaphore;
+		std::unique_lock<std::mutex> lock ( *waiting );
+		*u_must_wait = false;
+		waiting->notify_one();
+	}
 	else
 		*u_must_wait = false;
 }
@@ -3569,26 +6635,14 @@ XEPL::Rendezvous::Rendezvous ( Atom* _atom, Semaphore** _semaphore, bool* _must_
 //   88     88  `88888P'   dP   dP `88888P' dP    dP
 
 XEPL::Action::~Action ( void )
-{
-	if ( receptor )
-		receptor->Release();
-
-	if ( trigger_atom )
-		trigger_atom->Release();
-}
+{}
 
-XEPL::Action::Action ( Receptor* _receptor, Atom* _atom )
-	: receptor ( _receptor )
-	, trigger_atom    ( _atom )
+XEPL::Action::Action ( Ref<Receptor>&& _receptor, Atom* _atom )
+	: receptor        ( std::move ( _receptor ) )
+	, trigger_atom    ( _atom ? _atom->Escape() : nullptr )
 	, next_action     ( nullptr )
 {
 	++tlsLobe->counters.count_actions;
-
-	if ( receptor )
-		receptor->Attach();
-
-	if ( trigger_atom )
-		trigger_atom->Attach();
 }
 
 //   .d88888b  oo                            dP  .d888888             dP   oo
@@ -3600,13 +6654,13 @@ XEPL::Action::Action ( Receptor* _receptor, Atom* _atom )
 //                     .88
 //                 d8888P
 
-XEPL::SignalAction::SignalAction ( Receptor* _receptor, Atom* _atom )
-	: Action ( _receptor, _atom )
+XEPL::SignalAction::SignalAction ( Ref<Receptor>&& _receptor, Atom* _atom )
+	: Action ( std::move ( _receptor ), _atom )
 {}
 
 void XEPL::SignalAction::Action_Execute ( void )
 {
-	receptor->Receptor_Activate ( trigger_atom );
+	receptor->Receptor_Activate ( trigger_atom.Get() );
 }
 
 //   888888ba                              .d888888             dP   oo
@@ -3619,7 +6673,7 @@ void XEPL::SignalAction::Action_Execute ( void )
 //                               dP
 
 XEPL::DropAction::DropAction ( Neuron* _neuron )
-	: Action ( nullptr, nullptr )
+	: Action ( Ref<Receptor>(), nullptr )
 	, neuron ( _neuron )
 {
 	neuron->Attach();
@@ -3631,6 +6685,99 @@ void XEPL::DropAction::Action_Execute ( void )
 	neuron->Release();
 }
 
+XEPL::GeneAction::GeneAction ( Gene* _target, GeneMutation _mutation, Gene* _other, Atom* _completion )
+	: Action      ( Ref<Receptor>(), _completion )
+	, target_gene ( _target )
+	, other_gene  ( _other )
+	, mutation    ( _mutation )
+	, name_string ()
+	, term_string ()
+	, gene_answer ( nullptr )
+{}
+
+XEPL::GeneAction::GeneAction ( Gene* _target, GeneMutation _mutation, String&& _name, String&& _term )
+	: Action      ( Ref<Receptor>(), nullptr )
+	, target_gene ( _target )
+	, other_gene  ()
+	, mutation    ( _mutation )
+	, name_string ( std::move ( _name ) )
+	, term_string ( std::move ( _term ) )
+	, gene_answer ( nullptr )
+{}
+
+XEPL::GeneAction::GeneAction ( Gene* _target, GeneMutation _mutation, String&& _name, String&& _term, Gene* _other, GeneAnswer* _answer )
+	: Action      ( Ref<Receptor>(), nullptr )
+	, target_gene ( _target )
+	, other_gene  ( _other )
+	, mutation    ( _mutation )
+	, name_string ( std::move ( _name ) )
+	, term_string ( std::move ( _term ) )
+	, gene_answer ( _answer )
+{}
+
+void XEPL::GeneAction::Action_Execute ( void )
+{
+	Gene* gene = target_gene.Get();
+
+	switch ( mutation )
+	{
+		case mutate_nothing :
+			break;
+
+		case mutate_trait :
+			gene->Trait_Set ( std::move ( name_string ), std::move ( term_string ) );
+			break;
+
+		case mutate_assign :
+			gene->Assign_Content ( std::move ( term_string ) );
+			break;
+
+		case mutate_append :
+			gene->Append_Content ( std::move ( term_string ) );
+			break;
+
+		case mutate_add :
+			gene->Add_Gene ( other_gene.Get() );
+			break;
+
+		case mutate_remove :
+			gene->Remove_Gene ( other_gene.Get() );
+			break;
+
+		case mutate_absorb :
+			gene->Absorb_Gene ( other_gene.Get() );
+			break;
+
+		case mutate_absorb_traits :
+			gene->Absorb_Traits ( other_gene.Get() );
+			break;
+
+		case mutate_deflate :
+			gene->Deflate_Gene();
+			break;
+
+		case mutate_make_one :
+			gene_answer->gene = gene->Make_One ( name_string.c_str() );
+			break;
+
+		case mutate_make_one_gene :
+			gene_answer->made = gene->Make_One_Gene ( &name_string, &gene_answer->gene );
+			break;
+
+		case mutate_replace :
+			gene_answer->made = gene->Replace_Gene ( &name_string, other_gene.Get() );
+			break;
+
+		case mutate_tap :
+			gene_answer->cord = gene->Trait_Tap ( name_string.c_str(), term_string.c_str() );
+			break;
+
+		case mutate_share :
+			gene_answer->wire = gene->Share_Content();
+			break;
+	}
+}
+
 //    .d888888             dP   oo                   dP        oo            dP
 //   d8'    88             88                        88                      88
 //   88aaaaa88a .d8888b. d8888P dP .d8888b. 88d888b. 88        dP .d8888b. d8888P
@@ -3640,34 +6787,91 @@ void XEPL::DropAction::Action_Execute ( void )
 
 XEPL::ActionList::~ActionList ( void )
 {
-	delete actions_lock;
+	Flush_Action_list();
+
+	delete budget_semaphore;
 }
 
 XEPL::ActionList::ActionList ( Lobe* _lobe )
-	: actions_lock     ( new Mutex() )
+	: lobe             ( _lobe )
+	, list_is_closed   ( false )
+	, budget_semaphore ( new Semaphore() )
+	, budget_bytes     ( 0 )
+	, budget_policy    ( budget_block )
 	, head_action      ( nullptr )
+	, dequeued_bytes   ( 0 )
 	, tail_action      ( nullptr )
-	, lobe             ( _lobe )
-	, list_is_closed   ( false )
+	, enqueued_bytes   ( 0 )
+	, heap_bytes       ( 0 )
+	, budget_waiters   ( 0 )
+	, count_blocked    ( 0 )
+	, count_refused    ( 0 )
+	, count_spilled    ( 0 )
 {}
 
-void XEPL::ActionList::Close_Action_List()
+bool XEPL::ActionList::Link_Action ( Action* _action )
+{
+	_action->next_action.store ( nullptr, std::memory_order_relaxed );
+
+	Action* prior_tail = tail_action.exchange ( _action );
+
+	if ( !prior_tail )
+	{
+		head_action.store ( _action );
+		return true;
+	}
+
+	prior_tail->next_action.store ( _action, std::memory_order_release );
+	return false;
+}
+
+XEPL::Action* XEPL::ActionList::Take_Action ( void )
 {
-	MutexScope lock_actions ( actions_lock );
+	Action* action = head_action.load();
+
+	while ( !action )
+	{
+		if ( !tail_action.load() )
+			return nullptr;
+
+		std::this_thread::yield();
+		action = head_action.load();
+	}
+
+	Action* next = action->next_action.load ( std::memory_order_acquire );
+
+	if ( !next )
+	{
+		Action* expected = action;
+		if ( tail_action.compare_exchange_strong ( expected, nullptr ) )
+		{
+			expected = action;
+			head_action.compare_exchange_strong ( expected, nullptr );
+			return action;
+		}
+
+		while ( !( next = action->next_action.load ( std::memory_order_acquire ) ) )
+			std::this_thread::yield();
+	}
+
+	head_action.store ( next );
+	return action;
+}
 
+void XEPL::ActionList::Close_Action_List()
+{
 	lobe->Set_Flags(closed_flag);
 	list_is_closed = true;
+
+	Budget_Wake();
 }
 
 void XEPL::ActionList::Flush_Action_list()
 {
-	while ( head_action )
+	while ( Action* action = Take_Action() )
 	{
-		Action* action = head_action;
-		head_action = head_action->next_action;
-
-		if ( !head_action )
-			tail_action = nullptr;
+		if ( budget_bytes )
+			dequeued_bytes += HeapOfPools::Block_Bytes ( action );
 
 		delete action;
 	}
@@ -3675,49 +6879,116 @@ void XEPL::ActionList::Flush_Action_list()
 
 bool XEPL::ActionList::Pull_Action ( Action** _action )
 {
-	MutexScope lock_actions ( actions_lock );
-
 	if ( list_is_closed )
 	{
 		Flush_Action_list();
 		return false;
 	}
-	if ( head_action )
+
+	*_action = Take_Action();
+
+	if ( !*_action )
+		return true;
+
+	if ( budget_bytes )
 	{
-		*_action = head_action;
-		head_action = head_action->next_action;
+		dequeued_bytes += HeapOfPools::Block_Bytes ( *_action );
 
-		if ( !head_action )
-			tail_action = nullptr;
+		if ( budget_waiters )
+			Budget_Wake();
 	}
 	return true;
 }
 
-void XEPL::ActionList::Post_Action  ( Action* _action )
+void XEPL::ActionList::Set_Budget ( long _bytes, BudgetPolicy _policy )
+{
+	budget_bytes  = std::max ( 0L, _bytes );
+	budget_policy = _policy;
+}
+
+long XEPL::ActionList::Budget_Used ( void )
+{
+	return Queued_Bytes() + heap_bytes;
+}
+
+void XEPL::ActionList::Budget_Wake ( void )
+{
+	std::lock_guard<std::mutex> lock_budget ( *budget_semaphore );
+	budget_semaphore->notify_all();
+}
+
+bool XEPL::ActionList::Admit_Post ( void )
 {
-	bool wake_lobe = false;
+	if ( !budget_bytes || lobe == tlsLobe || Budget_Used() <= budget_bytes )
+		return true;
+
+	switch ( budget_policy )
 	{
-		MutexScope lock_actions ( actions_lock );
+		case budget_fail:
+			++count_refused;
+			return false;
+
+		case budget_spill:
+			++count_spilled;
+			return true;
+	}
 
-		if ( list_is_closed )
+	++count_blocked;
+	++budget_waiters;
+	{
+		std::unique_lock<std::mutex> lock_budget ( *budget_semaphore );
+		budget_semaphore->wait ( lock_budget, [this]
 		{
-			delete _action;
-			return;
-		}
+			return Budget_Used() <= budget_bytes || lobe->Test_Flags ( closed_flag );
+		} );
+	}
+	--budget_waiters;
 
-		_action->next_action = nullptr;
+	return true;
+}
 
-		if ( tail_action )
-			tail_action->next_action = _action;
-		else
-		{
-			head_action = _action;
-			wake_lobe = lobe != tlsLobe;
-		}
+void XEPL::ActionList::Publish_Heap ( long _bytes )
+{
+	heap_bytes = _bytes;
 
-		tail_action = _action;
+	if ( budget_waiters )
+		Budget_Wake();
+}
+
+void XEPL::ActionList::Report_Budget ( Gene* _gene )
+{
+	static Text* policy_names[] = { "block", "fail", "spill" };
+
+	String term;
+	term.assign ( std::to_string ( budget_bytes ) );
+	_gene->Trait_Set ( "budget", &term );
+	_gene->Trait_Set ( "policy", policy_names[budget_policy] );
+	term.assign ( std::to_string ( Budget_Used() ) );
+	_gene->Trait_Set ( "used", &term );
+	term.assign ( std::to_string ( Queued_Bytes() ) );
+	_gene->Trait_Set ( "queued", &term );
+	term.assign ( std::to_string ( heap_bytes ) );
+	_gene->Trait_Set ( "heap", &term );
+	term.assign ( std::to_string ( count_blocked ) );
+	_gene->Trait_Set ( "blocked", &term );
+	term.assign ( std::to_string ( count_refused ) );
+	_gene->Trait_Set ( "refused", &term );
+	term.assign ( std::to_string ( count_spilled ) );
+	_gene->Trait_Set ( "spilled", &term );
+}
+
+void XEPL::ActionList::Post_Action  ( Action* _action )
+{
+	if ( list_is_closed )
+	{
+		delete _action;
+		return;
 	}
-	if ( wake_lobe )
+
+	if ( budget_bytes )
+		enqueued_bytes += HeapOfPools::Block_Bytes ( _action );
+
+	if ( Link_Action ( _action ) && lobe != tlsLobe )
 		lobe->Lobe_Wake_Up();
 }
 
@@ -3751,23 +7022,20 @@ void XEPL::Ephemerals::Set ( Cord* _cord, Gene* _gene )
 //   dP dP    dP `88888P8 dP `88888P' dP `88888P' `88888P'
 
 XEPL::Indicies::Indicies()
-{
-	tail_bond = nullptr;
-}
+	: ChainT ()
+{}
 
 void XEPL::Indicies::Stack( Lobe* _host_lobe, Gene* _new_index )
 {
-	tail_bond = new Bond( _new_index, tail_bond );
+	Add_Atom ( _new_index );
 	_host_lobe->index_link = _new_index;
 }
 
 void XEPL::Indicies::Unstack( Lobe* _host_lobe )
 {
-	auto bond = tail_bond->prev_bond;
-	delete tail_bond;
-	tail_bond = bond;
-	if ( bond )
-		_host_lobe->index_link = static_cast<Gene*>(bond->atom);
+	Remove_Bond ( tail_bond );
+	if ( tail_bond )
+		_host_lobe->index_link = Atom_Of ( tail_bond );
 }
 
 XEPL::Gene* XEPL::Indicies::Index( int _up_count )
@@ -3777,7 +7045,7 @@ XEPL::Gene* XEPL::Indicies::Index( int _up_count )
 		bond = bond->prev_bond;
 
 	if ( bond )
-		return static_cast<Gene*>(bond->atom);
+		return Atom_Of ( bond );
 
 	return nullptr;
 }
@@ -3810,7 +7078,7 @@ XEPL::ScopeIndex::~ScopeIndex()
 //   d8'   .8P 88    88 88.  .88 88         88      88    88.  ... 88       88  88  88       88
 //    Y88888P  dP    dP `88888P' dP         dP      dP    `88888P' dP       dP  dP  dP `88888P'
 
-class XEPL::ShortTermMap : public MapT<Cord, String> {};
+class XEPL::ShortTermMap : public FlatMapT<String, String, StringHash> {};
 
 XEPL::ShortTerms::~ShortTerms()
 {
@@ -3867,8 +7135,19 @@ void XEPL::ShortTerms::Set ( Cord* _name_cord, Cord* _term_cord )
 
 void XEPL::ShortTerms::Set ( Text* _chars, Cord* _cord )
 {
-	Cord trait_name( _chars );
-	Set( &trait_name, _cord );
+	Set( String ( _chars ), _cord );
+}
+
+void XEPL::ShortTerms::Set ( String&& _name_string, Cord* _term_cord )
+{
+	if ( !_term_cord )
+		return;
+
+	if ( !term_map )
+		term_map = new ShortTermMap();
+
+	hot_terms = this;
+	term_map->insert_or_assign( std::move ( _name_string ), *_term_cord );
 }
 
 bool XEPL::ShortTerms::Get_Into ( Cord* _cord, String* _string )
@@ -3909,8 +7188,10 @@ void XEPL::ShortTerms::Nest_Traits ( Gene* _gene )
 
 	hot_terms = this;
 
-	for ( auto& [name, value] : *_gene->traits->map_of_traits )
-		term_map->insert_or_assign(name, value->trait_term);
+	ReadScope lock_Traits ( _gene->Read_Lock() );
+
+	for ( auto& [name, value] : _gene->traits->map_of_traits )
+		term_map->insert_or_assign(*name, value->trait_term);
 }
 
 //   .d88888b    dP            dP       dP           .88888.
@@ -3960,25 +7241,156 @@ XEPL::StableTraits::~StableTraits ( void )
 
 XEPL::StableTraits::StableTraits ( Gene* _gene )
 	: stable_traits   ( nullptr )
-	, current_trait   ( nullptr )
+	, trait_index     ( 0 )
+{
+	if ( _gene )
+		_gene->Duplicate_Traits ( &stable_traits );
+}
+
+XEPL::GeneVersion::~GeneVersion ( void )
+{
+	delete traits;
+}
+
+XEPL::GeneVersion::GeneVersion ( Gene* _gene )
+	: cell_name      ( _gene->cell_name )
+	, space_string   ( _gene->Space_String() )
+	, traits         ( nullptr )
+	, content_string ()
+	, has_content    ( false )
+	, inner_versions ()
+	, retired_next   ( nullptr )
+	, retired_epoch  ( 0 )
+{}
+
+XEPL::Cord* XEPL::GeneVersion::Trait_Raw ( std::string_view _name )
+{
+	if ( !traits )
+		return nullptr;
+
+	auto it  = traits->map_of_traits.Find ( _name );
+	if ( it == traits->map_of_traits.end() )
+		return nullptr;
+
+	return it->second->trait_term;
+}
+
+bool XEPL::GeneVersion::Get_First ( std::string_view _name, GeneVersion** _version )
+{
+	for ( GeneVersion* version : inner_versions )
+	{
+		if ( *version->cell_name == _name )
+		{
+			*_version = version;
+			return true;
+		}
+	}
+	return false;
+}
+
+void XEPL::GeneVersion::Print_Into ( String* _string, int _depth )
+{
+	if ( !_string )
+		return;
+
+	XmlBuilder x1 ( cell_name, _string, space_string );
+
+	if ( traits )
+		traits->Print_Into ( _string );
+
+	if ( has_content )
+	{
+		x1.Close_Attributes();
+		_string->append ( content_string );
+	}
+
+	if ( --_depth && !inner_versions.empty() )
+	{
+		x1.Close_Attributes();
+
+		for ( GeneVersion* version : inner_versions )
+			version->Print_Into ( _string, _depth );
+	}
+}
+
+void XEPL::GeneVersion::Retire ( GeneVersion* _retired )
+{
+	long epoch = global_epoch.fetch_add ( 1 );
+	long count = 1;
+
+	GeneVersion* tail = _retired;
+	tail->retired_epoch = epoch;
+
+	while ( tail->retired_next )
+	{
+		tail = tail->retired_next;
+		tail->retired_epoch = epoch;
+		++count;
+	}
+
+	{
+		std::lock_guard<SpinLock> lock_retired ( retired_lock );
+
+		tail->retired_next = retired_versions;
+		retired_versions   = _retired;
+	}
+
+	if ( ( retired_count += count ) > Memory::magazineSize )
+		Reclaim();
+}
+
+void XEPL::GeneVersion::Reclaim ( void )
+{
+	std::unique_lock<SpinLock> lock_retired ( retired_lock, std::try_to_lock );
+	if ( !lock_retired.owns_lock() )
+		return;
+
+	long oldest = EpochScope::Oldest_Pinned();
+
+	GeneVersion** link = &retired_versions;
+	while ( GeneVersion* version = *link )
+	{
+		if ( version->retired_epoch < oldest )
+		{
+			*link = version->retired_next;
+			--retired_count;
+			delete version;
+		}
+		else
+			link = &version->retired_next;
+	}
+}
+
+XEPL::GeneSnapshot::~GeneSnapshot ( void )
+{
+	if ( private_versions )
+		GeneVersion::Retire ( private_versions );
+}
+
+XEPL::GeneSnapshot::GeneSnapshot ( Gene* _gene )
+	: pinned_epoch     ()
+	, private_versions ( nullptr )
+	, version          ( nullptr )
 {
-	if ( _gene && _gene->Duplicate_Traits ( &stable_traits ) )
-		current_trait = stable_traits ? stable_traits->first_trait : nullptr;
+	bool cached = true;
+
+	if ( _gene )
+		version = _gene->Snapshot_Version ( &cached, &private_versions );
 }
 
 bool XEPL::StableTraits::Next_Trait ( Cord** _chars1, String** _chars2 )
 {
-	if ( !current_trait )
+	if ( !stable_traits || trait_index == stable_traits->map_of_traits.size() )
 	{
-		current_trait = stable_traits ? stable_traits->first_trait : nullptr;
+		trait_index = 0;
 		_chars1 = nullptr;
 		_chars2 = nullptr;
 		return false;
 	}
 
+	Trait* current_trait = stable_traits->map_of_traits.begin()[ trait_index++ ].second;
 	*_chars1 = current_trait->trait_name;
 	*_chars2 = current_trait->trait_term;
-	current_trait = current_trait->next_trait;
 	return true;
 }
 
@@ -4010,6 +7422,22 @@ void XEPL::Wire::Assign ( Cord* _cord )
 	wire_string->assign ( *_cord );
 }
 
+void XEPL::Wire::Assign ( String&& _string )
+{
+	MutexScope lock_wire ( wire_mutex );
+	wire_string->assign ( std::move ( _string ) );
+}
+
+void XEPL::Wire::Append ( String&& _string )
+{
+	MutexScope lock_wire ( wire_mutex );
+
+	if ( wire_string->empty() )
+		wire_string->assign ( std::move ( _string ) );
+	else
+		wire_string->append ( _string );
+}
+
 void XEPL::Wire::Append ( Wire* _wire )
 {
 	if ( !_wire )
@@ -4297,7 +7725,7 @@ XEPL::Script::Script ( Neuron* _neuron, Gene* _gene, String* _result )
 	, neuron  ( _neuron )
 	, rna     ( nullptr )
 	, lobe    ( tlsLobe )
-	, value   ( new String() )
+	, value   ( new ( tlsScratch ) String() )
 	, gene    ( _gene )
 	, truth   ( false )
 {
@@ -4306,7 +7734,7 @@ XEPL::Script::Script ( Neuron* _neuron, Gene* _gene, String* _result )
 		Translate(&content);
 
 	if (_result)
-		_result->assign( *value );
+		_result->assign( std::move ( *value ) );
 }
 
 XEPL::Script::Script ( Neuron* _neuron, Gene* _gene, Cord* _expr, String* _result )
@@ -4314,7 +7742,7 @@ XEPL::Script::Script ( Neuron* _neuron, Gene* _gene, Cord* _expr, String* _resul
 	, neuron  ( _neuron )
 	, rna     ( nullptr )
 	, lobe    ( tlsLobe )
-	, value   ( new String() )
+	, value   ( new ( tlsScratch ) String() )
 	, gene    ( _gene )
 	, truth   ( false )
 {
@@ -4324,7 +7752,7 @@ XEPL::Script::Script ( Neuron* _neuron, Gene* _gene, Cord* _expr, String* _resul
 	Translate( _expr );
 
 	if (_result)
-		_result->assign( *value );
+		_result->assign( std::move ( *value ) );
 }
 
 XEPL::Script::Script ( Neuron*  _neuron, Gene* _gene, Cord* _expr, String* _result, bool* _truth, Cord* _seed, bool _append )
@@ -4332,7 +7760,7 @@ XEPL::Script::Script ( Neuron*  _neuron, Gene* _gene, Cord* _expr, String* _resu
 	, neuron  ( _neuron )
 	, rna     ( nullptr )
 	, lobe    ( tlsLobe )
-	, value   ( new String( _seed ) )
+	, value   ( new ( tlsScratch ) String( _seed ) )
 	, gene    ( _gene )
 	, truth   ( false )
 {
@@ -4352,7 +7780,7 @@ XEPL::Script::Script ( Neuron*  _neuron, Gene* _gene, Cord* _expr, String* _resu
 		if ( _append )
 			_result->append ( *value );
 		else
-			_result->assign ( *value );
+			_result->assign ( std::move ( *value ) );
 	}
 }
 
@@ -4361,17 +7789,8 @@ void XEPL::Script::Translate (Cord* _expr )
 	RnaBag safe_bag( _expr, this );
 	parser_bag = rna = &safe_bag;
 
-	if ( gene && gene->content_mutex )
-	{
-		MutexScope lock_traits ( gene->content_mutex );
-		while ( !error_string && Get_Next_Value() )
-		{}
-	}
-	else
-	{
-		while ( !error_string && Get_Next_Value() )
-		{}
-	}
+	while ( !error_string && Get_Next_Value() )
+	{}
 
 	Report_Any_Errors();
 
@@ -4760,7 +8179,7 @@ void XEPL::Script::Extract_Parameter ( String** _string )
 {
 	String* value_was = value;
 	{
-		value = new String();
+		value = new ( tlsScratch ) String();
 		Get_Next_Value();
 		*_string = value;
 	}
@@ -4797,7 +8216,7 @@ void XEPL::Script::Tap_Local (  String* _tag, String* _value   )
 	if ( _value )
 	{
 		if ( !locals )
-			locals = new Gene ( nullptr, "Locals", nullptr );
+			locals = new ( tlsScratch ) Gene ( nullptr, "Locals", nullptr );
 
 		locals->Trait_Set ( _tag, _value );
 		return;
@@ -4831,7 +8250,7 @@ void XEPL::Script::Tap_Short_Term ( String* _tag, String* _value )
 
 	if ( _value )
 	{
-		terms->Set ( _tag, _value );
+		terms->Set ( std::move ( *_tag ), _value );
 		return;
 	}
 
@@ -5146,7 +8565,7 @@ bool XEPL::XmlParser::do_BeginNode()
 					xml_bag->Skip_Whitespace();
 
 					if ( Xml_New_Attribute ( &spacetag, &quoted_term, quote ) )
-						fresh.element_gene->Trait_Set ( &spacetag, &quoted_term );
+						fresh.element_gene->Trait_Set ( std::move ( spacetag ), std::move ( quoted_term ) );
 				}
 			}
 		}
@@ -5215,8 +8634,8 @@ bool XEPL::XmlParser::do_CloseSplit()
 		xml_bag->Skip_Whitespace();
 
 		if ( active_node->element_gene->cell_name->compare ( name ) != 0
-				|| ( active_node->element_gene->space_string
-					 && active_node->element_gene->space_string->compare ( *optional_string ) != 0 ) )
+				|| ( active_node->element_gene->Space_String()
+					 && active_node->element_gene->Space_String()->compare ( *optional_string ) != 0 ) )
 			Record_Error ( "Bad closing tag:", name.c_str() );
 
 		delete optional_string;
@@ -5234,7 +8653,7 @@ bool XEPL::XmlParser::do_Content()
 		xml_bag->Extract_PCData( &new_content );
 
 		if ( Xml_New_Content ( &new_content) )
-			active_node->element_gene->Assign_Content(&new_content);
+			active_node->element_gene->Assign_Content ( std::move ( new_content ) );
 
 		return true;
 	}
@@ -5247,7 +8666,7 @@ bool XEPL::XmlParser::do_CData()
 	{
 		String CData;
 		xml_bag->Extract_CData ( &CData );
-		active_node->element_gene->Append_Content ( &CData );
+		active_node->element_gene->Append_Content ( std::move ( CData ) );
 		return true;
 	}
 	return false;
@@ -5732,4 +9151,5 @@ void XEPL::xeplCantFind ( Text* _type, Nucleus* _nucleus, Text* _name )
 }
 
 thread_local XEPL::Lobe* XEPL::tlsLobe = nullptr;
+thread_local XEPL::OwnerBias* XEPL::tlsBias = nullptr;
 std::mutex   XEPL::output_lock;
@@ -42,8 +42,8 @@ Recycler / NoCopy
   Atom - Axon
   Atom - Kits::osFd - Kits::osSocket - osTcpSocket - osTcpServer
   Atom - Kits::ConnectedClient
-  Chain - GeneChain - Genes
-  Chain - NeuronChain : ReceptorChain
+  ChainT - GeneChain - Genes
+  ChainT - NeuronChain : AxonChain : ReceptorChain : Indicies
   Parser - Script
   Parser - XmlParser - PrintXml : XeplXml
   ParserBag - RnaBag : XmlBag
@@ -53,9 +53,12 @@ Recycler / NoCopy
 #pragma once
 
 #include <atomic>
+#include <cassert>
 #include <condition_variable>
 #include <mutex>
+#include <shared_mutex>
 #include <thread>
+#include <typeinfo>
 
 #include <iostream>
 #include <fstream>
@@ -63,12 +66,16 @@ Recycler / NoCopy
 #include <iomanip>
 
 #include <string>
+#include <string_view>
 #include <list>
 #include <map>
 #include <set>
 #include <unordered_map>
 #include <vector>
 #include <cstring>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
 
 #include <algorithm>
 
@@ -80,11 +87,23 @@ namespace XEPL
 	union BlockHeader;
 	class PoolOfBlocks;
 	class HeapOfPools;
+	class RemoteInbox;
+	class SlabPage;
+	class HugeRegion;
+	class ScratchArena;
+	class MagazineDepot;
+	class MemoryProfile;
+	class ProfileCounts;
+	class SizeClasses;
 	class Recycler;
+	class CacheAlignedRecycler;
 	class Backpack;
+	class ThreadBackpack;
 
 	/// text handling
 	class String;
+	class Symbol;
+	class Symbols;
 	class Wire;
 	typedef const String Cord;
 	typedef const char   Text;
@@ -92,14 +111,21 @@ namespace XEPL
 	/// thread managment
 	class Mutex;
 	class MutexScope;
+	class NoLock;
+	class SpinLock;
+	class GeneLock;
+	class ReadScope;
+	class WriteScope;
+	class EpochScope;
 	class MutexResource;
 	class Semaphore;
 	class Thread;
 
 	/// atoms = the reference counted everything
 	class Atom;
+	class OwnerBias;
 	class Bond;
-	class Chain;
+	template <class TAtom, class TLock> class ChainT;
 
 	/// cell - atoms with a name
 	class Cell;
@@ -114,6 +140,9 @@ namespace XEPL
 	class Genes;
 	class GeneChain;
 	class GeneScope;
+	class GeneVersion;
+	class GeneSnapshot;
+	class GeneExtension;
 	class Ephemerals;
 	class DuplicateTraits;
 	class ShortTerms;
@@ -142,6 +171,8 @@ namespace XEPL
 	class Action;
 	class ActionList;
 	class DropAction;
+	class GeneAction;
+	class GeneOwner;
 	class SignalAction;
 	class ScopeIndex;
 	class Indicies;
@@ -196,6 +227,7 @@ namespace XEPL
 	/// option flags
 	extern bool Show_Trace;
 	extern bool Show_Memory_Counts;
+	extern bool Show_Memory_Profile;
 	extern bool Show_Counters;
 	
 		/// global routines
@@ -240,15 +272,40 @@ namespace XEPL
 	namespace Memory
 	{
 		static constexpr long poolWidth    = 16;
-		static constexpr long maxPoolIndex =  5;
+		static constexpr long maxPoolIndex = 40;
+		static constexpr long cacheLine    = 64;
+		static constexpr long linePools    = 16;
+		static constexpr long maxPoolSlot  = maxPoolIndex + linePools;
+		static constexpr long linearLimit  = 128;
+		static constexpr long pooledLimit  = 4*1024;
+		static constexpr long maxPooled    = 32*1024;
 		static constexpr long overHead     = sizeof( void* );
+		static constexpr int  maxHeaps     = 256;
+		static constexpr long slabPageSize = 64*1024;
+		static constexpr long slabHeader   = 64;
+		static constexpr long hugePageSize = 2*1024*1024;
+		static constexpr long trimDecay    = 8;
+		static constexpr long trimFloor    = 256*1024;
+		static constexpr long scratchPages = 16;
+		static constexpr long magazineSize = 64;
+		static constexpr long depotShelf   = 64;
+		static constexpr long highWater    = 256*1024;
+		static constexpr long maxProfiled  = 64;
+		static constexpr long profileEvery = 1024;
+		static constexpr long profileSites = 256;
+		static constexpr int  profileDepth = 8;
+		static constexpr long symbolShards = 64;
+		static constexpr long symbolBuckets = 64;
+		static constexpr int  heldGenes    = 64;
+		static constexpr int  epochSlots   = 256;
+		static constexpr int  biasSlots    = 4096;
 	}
 
 	/// memory counters
-	extern std::atomic_size_t   pool_mallocs[Memory::maxPoolIndex+1];
-	extern std::atomic_size_t    pool_cached[Memory::maxPoolIndex+1];
-	extern std::atomic_size_t     pool_freed[Memory::maxPoolIndex+1];
-	extern std::atomic_size_t      pool_held[Memory::maxPoolIndex+1];
+	extern std::atomic_size_t   pool_mallocs[Memory::maxPoolSlot+1];
+	extern std::atomic_size_t    pool_cached[Memory::maxPoolSlot+1];
+	extern std::atomic_size_t     pool_freed[Memory::maxPoolSlot+1];
+	extern std::atomic_size_t      pool_held[Memory::maxPoolSlot+1];
 	extern std::atomic_size_t   total_mallocs;
 	extern std::atomic_size_t    total_cached;
 	extern std::atomic_size_t     total_freed;
@@ -256,56 +313,308 @@ namespace XEPL
 	extern std::atomic_size_t   total_biggies_out;
 	extern std::atomic_size_t   total_biggies_in;
 	extern std::atomic_size_t   largest_biggie;
+	extern std::atomic_size_t   total_remote_frees;
+	extern std::atomic_size_t   total_remote_reclaimed;
+	extern std::atomic_size_t   total_malloc_avoided;
+	extern std::atomic_size_t   total_slab_pages;
+	extern std::atomic_size_t   total_slab_pages_freed;
+	extern std::atomic_size_t   total_scratch_blocks;
+	extern std::atomic_size_t   total_scratch_pages;
+	extern std::atomic_size_t   total_scratch_pages_freed;
+	extern std::atomic_size_t   total_depot_pushed;
+	extern std::atomic_size_t   total_depot_pulled;
+	extern std::atomic_size_t   total_depot_drained;
+	extern std::atomic_size_t   total_huge_regions;
+	extern std::atomic_size_t   total_huge_regions_freed;
+	extern std::atomic_size_t   total_huge_pages;
+	extern std::atomic_size_t   total_trimmed;
+	extern std::atomic_size_t   total_thread_heaps;
+	extern std::atomic_size_t   total_orphaned;
+	extern std::atomic_size_t   total_orphans_adopted;
 	extern std::atomic_size_t   num_total_news;
 	extern std::atomic_size_t   num_total_dels;
 
+	/// block sizes of the pools, linear then geometric, fixed while heaps are alive
+	class SizeClasses
+	{
+	public:
+		static long           class_count;
+		static long           pool_count;
+		static long           pooled_limit;
+		static long           class_bytes  [ Memory::maxPoolSlot+1 ];
+		static unsigned char  class_lookup [ Memory::maxPooled/Memory::poolWidth+1 ];
+		explicit SizeClasses ( long linear_limit, long pooled_limit );
+		static void Configure ( long linear_limit, long pooled_limit );
+	};
+
+	/// where a heap gets its slab pages
+	using PagePolicy = int;
+	static constexpr PagePolicy standard_pages = 0;
+	static constexpr PagePolicy huge_pages     = 1;
+
+	/// allocation counts of one type
+	class ProfileCounts
+	{
+	public:
+		size_t  allocs;
+		size_t  frees;
+		long    live_bytes;
+		long    peak_bytes;
+	};
+
 	/// limted list of memory pools
 	extern thread_local class HeapOfPools
 	{
-		PoolOfBlocks*    pool_of_blocks[Memory::maxPoolIndex+1];
+		PoolOfBlocks*    pool_of_blocks[Memory::maxPoolSlot+1];
+		long             pool_count;
+		int              heap_slot;
+		int              heap_generation;
 		size_t           count_biggies_out;
 		size_t           count_biggies_in;
 		size_t           largest_biggie_out;
-	public:
+		size_t           count_remote_frees;
+		size_t           count_remote_reclaimed;
+		size_t           count_malloc_avoided;
+		size_t           profile_ticks;
+		ProfileCounts    profile_counts[Memory::maxProfiled];
+		PagePolicy       page_policy;
+		HugeRegion*      huge_region;
+		size_t           count_pages;
+		size_t           count_huge_pages;
+		size_t           count_huge_regions;
+		size_t           count_trims;
+		size_t           count_trimmed;
+		size_t           bytes_trimmed;
+		size_t           count_orphaned;
+		size_t           count_adopted;
+		void  Remote_Free   ( BlockHeader* );
+		void  Take_Returned ( void* );
+		void  Adopt_Orphans ( void );
+		static void   Foreign_Slab ( void*, SlabPage* );
+	public:
+		static size_t Block_Bytes  ( void* );
 		~HeapOfPools( void );
-		HeapOfPools ( void );
+		explicit HeapOfPools ( PagePolicy );
+		SlabPage* New_Page  ( void );
 		void* Get_Block     ( size_t );
+		void* Get_Line_Block ( size_t );
 		void  Recycle_Block ( void*  );
+		void  Recycle_Line_Block ( void* );
+		long  Bytes_In_Use  ( void );
+		void  Reclaim_Remote_Blocks ( void );
+		void  Prewarm_Slabs ( long pages_per_pool );
+		void  Trim_Pools    ( long decay_rests );
 		void  Report        ( String* );
+		void  Profile_New    ( long type_tag, void* );
+		void  Profile_Delete ( long type_tag, void* );
+		void  Profile_Into   ( Gene* );
+		static void* Orphan_New    ( size_t );
+		static void  Orphan_Free   ( void* );
+		static void  Drain_Orphans ( void );
 	} *tlsHeap;
 
 	/// header in front of every memory block
 	union BlockHeader
 	{
 		BlockHeader*    next_block;
-		long            pool_index;
+		struct
+		{
+			short       pool_index;
+			short       heap_slot;
+			int         heap_generation;
+		}               owner;
+	};
+
+	/// lock-free return path for blocks released by a foreign thread,
+	/// each claim of a slot starts a new generation so a dead heap's blocks never reach the next heap's pools
+	class RemoteInbox
+	{
+		friend class    HeapOfPools;
+		friend class    SizeClasses;
+		static BlockHeader  closed_marker;
+		static RemoteInbox  inbox_slots[Memory::maxHeaps];
+		static RemoteInbox  orphan_blocks;
+		alignas(64) std::atomic<void*> returned_blocks;
+		std::atomic_bool    slot_in_use;
+		std::atomic_int     slot_generation;
+		static int  Claim_Slot   ( void );
+		static void Release_Slot ( int );
+		static bool Any_In_Use   ( void );
+		bool  Push_Block         ( void* );
+		bool  Push_Owned         ( BlockHeader* );
+		void* Take_Blocks        ( bool closing );
+	};
+
+	/// aligned page of headerless blocks, the page address gives the pool
+	class SlabPage
+	{
+		friend class        HeapOfPools;
+		friend class        PoolOfBlocks;
+		friend class        ScratchArena;
+		SlabPage*           next_page;
+		long                pool_index;
+		std::atomic<short>  heap_slot;
+		long                blocks_carved;
+		std::atomic_long    orphan_blocks;
+		HugeRegion*         huge_region;
+		static bool      Is_Slab_Block ( void* );
+		static SlabPage* Page_Of       ( void* );
+		void Orphan_Release ( void );
+		void Free_Page      ( void );
+	};
+
+	/// 2MB mapping carved into slab pages, unmapped when the last page returns
+	class HugeRegion
+	{
+		friend class        HeapOfPools;
+		friend class        SlabPage;
+		char*               region_base;
+		char*               carve_next;
+		std::atomic_long    region_refs;
+		bool                huge_advised;
+		static HugeRegion* Map_Region ( void );
+		void Release_Region ( void );
+	};
+
+	/// shared shelf of full magazines, rebalances blocks between heaps
+	class MagazineDepot
+	{
+		friend class    PoolOfBlocks;
+		static MagazineDepot  depot_shelves[Memory::maxPoolSlot+1];
+		std::mutex      shelf_lock;
+		BlockHeader*    magazines;
+		std::atomic_long magazine_count;
+		bool          Push_Magazine ( BlockHeader* );
+		BlockHeader*  Pull_Magazine ( void );
+	public:
+		static void   Drain_Shelves ( void );
 	};
 
 	/// single list of same sized memory blocks
 	class PoolOfBlocks
 	{
 		friend class    HeapOfPools;
+		HeapOfPools*    owner_heap;
 		BlockHeader*    head_block;
+		void*           free_slab;
+		SlabPage*       slab_pages;
+		SlabPage*       fresh_pages;
+		char*           carve_next;
+		char*           carve_limit;
 		const long      pool_index;
+		const int       heap_slot;
+		const int       heap_generation;
 		const size_t    block_size;
+		const size_t    high_water;
+		bool            slab_mode;
 		size_t          blocks_malloced;
 		size_t          blocks_cached;
 		size_t          blocks_freed;
 		size_t          blocks_holding;
+		size_t          slab_page_count;
+		size_t          head_count;
+		size_t          blocks_pushed;
+		size_t          blocks_pulled;
+		size_t          trim_mark;
+		size_t          demand_average;
+		size_t          blocks_trimmed;
 		~PoolOfBlocks( void );
-		explicit PoolOfBlocks ( long );
+		explicit PoolOfBlocks ( HeapOfPools*, long, int, int );
 		void* Get_Or_Malloc   ( void );
+		void* Carve_Slab      ( void );
 		void  Catch_Or_Free   ( BlockHeader* );
+		void  Catch_Returned  ( BlockHeader* );
+		void  Catch_Slab      ( void* );
+		void  Catch_Block     ( BlockHeader* );
+		void  Adopt_Block     ( BlockHeader* );
+		bool  Push_Magazine   ( void );
+		bool  Pull_Magazine   ( void );
+		size_t Trim_Blocks    ( long decay_rests );
+		size_t Blocks_Owned   ( void );
+		long   Blocks_In_Use  ( void );
+		long  Add_Slab_Pages  ( long );
+		void  Release_Slabs   ( void );
 		void  Report          ( String* );
 	};
 
+	/// attributes Recycler traffic to types and sampled call sites
+	class MemoryProfile
+	{
+		friend class    HeapOfPools;
+		class ProfileSite
+		{
+		public:
+			long    type_tag;
+			int     depth;
+			size_t  hits;
+			void*   frames[Memory::profileDepth];
+		};
+		static std::atomic_long     type_count;
+		static std::atomic<Text*>   type_names  [ Memory::maxProfiled ];
+		static ProfileCounts        type_totals [ Memory::maxProfiled ];
+		static ProfileSite          sample_sites[ Memory::profileSites ];
+		static std::mutex           profile_lock;
+		static void Sample_Site ( long type_tag );
+		static void Fold_Counts ( ProfileCounts* );
+	public:
+		static long Register_Type ( Text* mangled_name );
+		static void Reset_Profile ( void );
+		static void Print_Profile ( std::ostream* );
+	};
+
 	/// base class recycler
 	class Recycler
 	{
 	public:
 		static void* operator new    ( size_t );
 		static void  operator delete ( void*  );
+		static void* operator new    ( size_t, ScratchArena* );
+		static void  operator delete ( void*,  ScratchArena* );
+		static void* Profiled_New    ( size_t, long type_tag, ScratchArena* = nullptr );
+		static void  Profiled_Delete ( void*,  long type_tag );
 		static void Report_Heap( String* into_string );
+		static void Profile_Heap( Gene* into_gene );
+		static void Reclaim_Heap( void );
+		static void Prewarm_Heap( long pages_per_pool );
+		static void Trim_Heap( long decay_rests );
+		static long Heap_Bytes( void );
+	};
+
+	/// whole cache line blocks, keeps atoms shared across Lobes off their neighbours' lines
+	class CacheAlignedRecycler
+	{
+		static void  Free_Line_Block ( void* );
+	public:
+		static void* operator new    ( size_t );
+		static void* operator new    ( size_t, std::align_val_t );
+		static void  operator delete ( void*  );
+		static void  operator delete ( void*,  std::align_val_t );
+	};
+
+	/// tags a Recycler class so the profiler can name its blocks
+	template <class T>
+	class RecycleAsT
+	{
+	public:
+		static long Type_Tag ( void ) {
+			static const long type_tag = MemoryProfile::Register_Type ( typeid ( T ).name() );
+			return type_tag;
+		}
+		static void* operator new ( size_t _size ) {
+			return Show_Memory_Profile ? Recycler::Profiled_New ( _size, Type_Tag() ) : Recycler::operator new ( _size );
+		}
+		static void operator delete ( void* _ptr ) {
+			if ( Show_Memory_Profile )
+				Recycler::Profiled_Delete ( _ptr, Type_Tag() );
+			else
+				Recycler::operator delete ( _ptr );
+		}
+		static void* operator new ( size_t _size, ScratchArena* _arena ) {
+			return Show_Memory_Profile ? Recycler::Profiled_New ( _size, Type_Tag(), _arena ) : Recycler::operator new ( _size, _arena );
+		}
+		static void operator delete ( void* _ptr, ScratchArena* ) {
+			operator delete ( _ptr );
+		}
 	};
 
 	/// some things shouldn't be allocated
@@ -327,13 +636,46 @@ namespace XEPL
 		NoCopy& operator=(       NoCopy&&) = delete;
 	};
 
+	/// bump pages for action scoped objects, released wholesale by the Lobe
+	class ScratchArena : public NoCopy
+	{
+		SlabPage*  first_page;
+		SlabPage*  bump_page;
+		char*      bump_next;
+		char*      bump_limit;
+		long       page_count;
+		size_t     blocks_bumped;
+		bool  Next_Page ( void );
+	public:
+		~ScratchArena ( void );
+		ScratchArena  ( void );
+		void* Get_Block ( size_t );
+		void  Reset     ( void );
+		void  Report    ( String* );
+	};
+
+	/// open only while the Lobe dispatches an Action
+	extern thread_local ScratchArena* tlsScratch;
+
 	/// master backpack 1 per thread
 	class Backpack : NoAllocator, NoCopy
 	{
 		HeapOfPools*  heap;
+		HeapOfPools*  previous_heap;
 	public:
+		const PagePolicy  page_policy;
 		~Backpack();
-		Backpack();
+		explicit Backpack ( PagePolicy = standard_pages );
+	};
+
+	/// lazy backpack of a thread that is not a Lobe, unpacked at thread exit
+	class ThreadBackpack : public Backpack
+	{
+		static thread_local bool  backpack_unpacked;
+	public:
+		~ThreadBackpack();
+		explicit ThreadBackpack ( void );
+		static HeapOfPools* Thread_Heap ( void );
 	};
 
 	/// C++ leak detector
@@ -352,7 +694,7 @@ namespace XEPL
 	public:
 		~RecycleCounts ( void );
 		explicit RecycleCounts ( std::ostream* );
-		void    Print_Pool_Counts( std::ostream*, Text*, const std::atomic_size_t&, std::atomic_size_t*, int );
+		void    Print_Pool_Counts( std::ostream*, int );
 	};
 
 	/// template allocator support
@@ -370,11 +712,20 @@ namespace XEPL
 		template <class U>
 		explicit TAllocatorT ( const TAllocatorT<U>& ) {}
 		TAllocatorT ( void ) {}
+		template <class U>
+		bool operator== ( const TAllocatorT<U>& ) const { return true;  }
+		template <class U>
+		bool operator!= ( const TAllocatorT<U>& ) const { return false; }
 		pointer allocate ( size_type _num ) {
+			if ( Show_Memory_Profile )
+				return ( T* ) ( Recycler::Profiled_New ( _num * sizeof ( T ), RecycleAsT<TAllocatorT>::Type_Tag() ) );
 			return ( T* ) ( Recycler::operator new ( _num * sizeof ( T ) ) );
 		}
 		void deallocate ( pointer _ptr, size_type ) {
-			Recycler::operator delete ( _ptr );
+			if ( Show_Memory_Profile )
+				Recycler::Profiled_Delete ( _ptr, RecycleAsT<TAllocatorT>::Type_Tag() );
+			else
+				Recycler::operator delete ( _ptr );
 		}
 	};
 
@@ -388,11 +739,11 @@ namespace XEPL
 //    |  | |  | |    ___]
 //
 
-	/// recycled ordered map of string keys
+	/// recycled ordered map of string keys, found by any string like key
 	template <class Tkey, class Tvalue>
 	class MapT
 	: public Recycler
-	, public std::map< Tkey, Tvalue, std::less<Tkey>, 
+	, public std::map< Tkey, Tvalue, std::less<>, 
 		TAllocatorT<std::pair<const Tkey, Tvalue> > >
 	{};
 
@@ -405,8 +756,8 @@ namespace XEPL
 	{};
 
 	/// ordered map, delete the value on extract
-	template<class TKey, typename TPtr=void*>
-	class MapDeleteT : public MapT<TKey, TPtr>
+	template<class TKey, typename TPtr=void*, class TMap = MapT<TKey, TPtr>>
+	class MapDeleteT : public TMap
 	{
 	public:
 		~MapDeleteT ( void ) {
@@ -417,6 +768,154 @@ namespace XEPL
 		}
 	};
 
+	/// hashes any string like key by its characters
+	class StringHash
+	{
+	public:
+		size_t operator() ( std::string_view _string ) const { return std::hash<std::string_view>() ( _string ); }
+	};
+
+	/// recycled small map, flat in insertion order; the first TInline entries live inside the map
+	/// and a hashed index over the entries is built by the writer once it holds more than THashAt,
+	/// so find never modifies the map and is safe for concurrent readers
+	template <class Tkey, class Tvalue, class THash, size_t TInline = 4, size_t THashAt = 16>
+	class FlatMapT : public Recycler
+	{
+	public:
+		using value_type = std::pair<Tkey, Tvalue>;
+		using iterator   = value_type*;
+	private:
+		using IndexMap   = std::unordered_map<Tkey, size_t, THash, std::equal_to<Tkey>,
+			TAllocatorT<std::pair<const Tkey, size_t>>>;
+		value_type*  entries;
+		size_t       entry_count;
+		size_t       entry_capacity;
+		IndexMap*    hashed_index;
+		alignas ( value_type ) unsigned char inline_entries[ TInline * sizeof ( value_type ) ];
+
+		value_type* Inline_Entries ( void ) { return reinterpret_cast<value_type*> ( inline_entries ); }
+
+		void Grow ( size_t _capacity )
+		{
+			value_type* grown = TAllocatorT<value_type>().allocate ( _capacity );
+			for ( size_t i = 0; i < entry_count; ++i )
+			{
+				new ( grown + i ) value_type ( std::move ( entries[i] ) );
+				entries[i].~value_type();
+			}
+			if ( entries != Inline_Entries() )
+				TAllocatorT<value_type>().deallocate ( entries, entry_capacity );
+			entries        = grown;
+			entry_capacity = _capacity;
+		}
+
+		void Index_Entries ( void )
+		{
+			delete hashed_index;
+			hashed_index = nullptr;
+
+			if ( entry_count <= THashAt )
+				return;
+
+			hashed_index = new IndexMap();
+			hashed_index->reserve ( entry_count );
+			for ( size_t i = 0; i < entry_count; ++i )
+				hashed_index->emplace ( entries[i].first, i );
+		}
+
+	public:
+		~FlatMapT ( void )
+		{
+			clear();
+			delete hashed_index;
+			if ( entries != Inline_Entries() )
+				TAllocatorT<value_type>().deallocate ( entries, entry_capacity );
+		}
+		FlatMapT ( void )
+			: entries        ( Inline_Entries() )
+			, entry_count    ( 0 )
+			, entry_capacity ( TInline )
+			, hashed_index   ( nullptr )
+		{}
+		FlatMapT ( const FlatMapT& )            = delete;
+		FlatMapT& operator= ( const FlatMapT& ) = delete;
+
+		iterator begin ( void )       { return entries; }
+		iterator end   ( void )       { return entries + entry_count; }
+		size_t   size  ( void ) const { return entry_count; }
+		bool     empty ( void ) const { return entry_count == 0; }
+
+		void reserve ( size_t _count )
+		{
+			if ( _count > entry_capacity )
+				Grow ( _count );
+		}
+
+		iterator find ( const Tkey& _key )
+		{
+			if ( hashed_index )
+			{
+				auto it = hashed_index->find ( _key );
+				return it == hashed_index->end() ? end() : entries + it->second;
+			}
+			for ( iterator it = begin(); it != end(); ++it )
+				if ( it->first == _key )
+					return it;
+			return end();
+		}
+
+		template <class Tk>
+		std::pair<iterator, bool> try_emplace ( Tk&& _key )
+		{
+			iterator found = find ( _key );
+			if ( found != end() )
+				return { found, false };
+
+			if ( entry_count == entry_capacity )
+				Grow ( entry_capacity * 2 );
+
+			iterator fresh = new ( entries + entry_count ) value_type ( std::forward<Tk> ( _key ), Tvalue() );
+			++entry_count;
+
+			if ( hashed_index )
+				hashed_index->emplace ( fresh->first, entry_count - 1 );
+			else if ( entry_count > THashAt )
+				Index_Entries();
+
+			return { fresh, true };
+		}
+
+		template <class Tk, class Tv>
+		std::pair<iterator, bool> insert_or_assign ( Tk&& _key, Tv&& _value )
+		{
+			auto result = try_emplace ( std::forward<Tk> ( _key ) );
+			result.first->second = std::forward<Tv> ( _value );
+			return result;
+		}
+
+		iterator erase ( iterator _at )
+		{
+			for ( iterator it = _at; it + 1 != end(); ++it )
+				*it = std::move ( *( it + 1 ) );
+			entries[ --entry_count ].~value_type();
+
+			if ( hashed_index )
+				Index_Entries();
+
+			return _at;
+		}
+
+		void clear ( void )
+		{
+			for ( size_t i = 0; i < entry_count; ++i )
+				entries[i].~value_type();
+			entry_count = 0;
+
+			delete hashed_index;
+			hashed_index = nullptr;
+		}
+	};
+
 
 
 	/// std Mutex wrapper
@@ -425,6 +924,8 @@ namespace XEPL
 	public:
 		std::recursive_mutex  mutex;
 		Mutex();
+		void lock   ( void )  { mutex.lock();   }
+		void unlock ( void )  { mutex.unlock(); }
 	};
 
 	/// Stack for hoilding locked mutex
@@ -436,6 +937,68 @@ namespace XEPL
 		explicit MutexScope ( Mutex* locking_mutex );
 	};
 
+	/// lock policy for chains private to one thread
+	class NoLock
+	{
+	public:
+		void lock   ( void )  {}
+		void unlock ( void )  {}
+	};
+
+	/// lock policy for shared chains that are never re-entered
+	class SpinLock
+	{
+		std::atomic_flag  spin_flag = ATOMIC_FLAG_INIT;
+	public:
+		void lock     ( void )  { while ( spin_flag.test_and_set ( std::memory_order_acquire ) ) std::this_thread::yield(); }
+		bool try_lock ( void )  { return !spin_flag.test_and_set ( std::memory_order_acquire ); }
+		void unlock   ( void )  { spin_flag.clear ( std::memory_order_release ); }
+	};
+
+	/// the reader/writer lock in a Gene's flag word, each Gene locks alone and waiting writers hold off new readers;
+	/// a Gene held shared is never upgraded, writing a Gene inside its own ReadScope is a hard error in every build;
+	/// the link bit holds a Gene's owner_link, and with it the owner, in place while versions are retired up the tree
+	class GeneLock
+	{
+		friend class ReadScope;
+		friend class WriteScope;
+		static void Hold_Shared    ( Atom* );
+		static void Drop_Shared    ( Atom* );
+		static void Hold_Exclusive ( Atom* );
+		static void Drop_Exclusive ( Atom* );
+	public:
+		[[noreturn]] static void Refuse ( Text* lock_misuse );
+		static void Hold_Link ( Atom* linked_gene );
+		static void Drop_Link ( Atom* linked_gene );
+	};
+
+	/// Stack for holding a Gene's lock shared, re-entrant per thread
+	class ReadScope : NoAllocator
+	{
+		Atom*  locked_gene;
+	public:
+		~ReadScope ( void );
+		explicit ReadScope ( Atom* reading_gene );
+	};
+
+	/// Stack for holding a Gene's lock exclusive, re-entrant per thread
+	class WriteScope : NoAllocator
+	{
+		Atom*  locked_gene;
+	public:
+		~WriteScope ( void );
+		explicit WriteScope ( Atom* writing_gene );
+	};
+
+	/// Stack for pinning the reclamation epoch while GeneVersions are read
+	class EpochScope : NoAllocator
+	{
+	public:
+		~EpochScope ( void );
+		EpochScope  ( void );
+		static long Oldest_Pinned ( void );
+	};
+
 	/// std::thread wrapper
 	class Thread
 	{
@@ -471,46 +1034,209 @@ namespace XEPL
 
 
 	/// my recycled string class
-	class String : public Recycler, public CppString
+	class String : public Recycler, public CppString, public RecycleAsT<String>
 	{
 	public:
+		using RecycleAsT<String>::operator new;
+		using RecycleAsT<String>::operator delete;
 		~String ( void );
 		String  ( void );
 		String          ( Text*             from_cstring    );
 		String          ( const CppString*  from_std_string );
 		explicit String ( Cord*             from_xepl_string );
 		explicit String ( Text*             from_chars, size_t number_of_bytes );
+		String          ( const String&     copy_string  );
+		String          ( String&&          adopt_string ) noexcept;
+		String& operator= ( const String&   copy_string  );
+		String& operator= ( String&&        adopt_string ) noexcept;
+	};
+
+	/// an interned name, equal names share one Symbol
+	class Symbol : public String
+	{
+		friend class  Symbols;
+		std::atomic<Symbol*> next_symbol;
+	public:
+		const size_t  symbol_hash;
+		explicit Symbol ( Text* from_chars, size_t number_of_bytes, size_t symbol_hash, Symbol* next_symbol );
 	};
 
+	/// one shard's bucket array, published whole, kept until the Symbols are released
+	class SymbolTable
+	{
+	public:
+		SymbolTable*  retired_table;
+		size_t        bucket_mask;
+		std::atomic<Symbol*>* Heads ( void ) { return reinterpret_cast<std::atomic<Symbol*>*> ( this+1 ); }
+		static SymbolTable*   Create ( size_t buckets, SymbolTable* retired );
+	};
 
+	/// process wide name interner, a name is one stable Cord with its hash worked out once,
+	/// lookups take no lock, only an Insert does and a reader who misses while a shard grows asks again under it
+	class Symbols
+	{
+		static Symbols  symbol_shards[Memory::symbolShards];
+		std::mutex      shard_lock;
+		std::atomic<SymbolTable*> symbol_table;
+		std::atomic<size_t>       grow_sequence;
+		size_t          symbol_count;
+		Symbol* Lookup  ( Text*, size_t, size_t hash );
+		Symbol* Insert  ( Text*, size_t, size_t hash );
+		static size_t Hash_Text ( Text*, size_t );
+		static Cord*  Intern    ( Text*, size_t );
+	public:
+		static Cord*  Intern  ( Cord* name );
+		static Cord*  Intern  ( Text* name );
+		static Cord*  Find    ( std::string_view name );
+		static size_t Count   ( void );
+		static void   Release_Symbols ( void );
+	};
 
-	/// all atoms share common flags
+	/// hashes an interned name by its precomputed hash
+	class SymbolHash
+	{
+	public:
+		size_t operator() ( Cord* _symbol ) const { return static_cast<const Symbol*> ( _symbol )->symbol_hash; }
+	};
+
+	/// recycled hash map keyed by interned names, equal keys are equal pointers
+	template <class Tvalue>
+	class SymbolMapT
+	: public Recycler
+	, public std::unordered_map<Cord*, Tvalue, SymbolHash, std::equal_to<Cord*>,
+		TAllocatorT<std::pair<Cord* const, Tvalue>>>
+	{
+	public:
+		auto Find ( std::string_view _name ) {
+			Cord* symbol = Symbols::Find ( _name );
+			return symbol ? this->find ( symbol ) : this->end();
+		}
+		auto Find ( Cord* _name ) { return Find ( std::string_view ( *_name ) ); }
+	};
+
+	/// small flat map keyed by interned names, found by any string like key
+	template <class Tvalue, size_t TInline = 4>
+	class SymbolFlatMapT : public FlatMapT<Cord*, Tvalue, SymbolHash, TInline>
+	{
+	public:
+		auto Find ( std::string_view _name ) {
+			Cord* symbol = Symbols::Find ( _name );
+			return symbol ? this->find ( symbol ) : this->end();
+		}
+		auto Find ( Cord* _name ) { return Find ( std::string_view ( *_name ) ); }
+	};
+
+
+
+	/// all atoms share common flags, a Gene keeps its reader/writer lock in the bits above them and counts its edits above that
 	using AtomFlags = long;
 	static constexpr AtomFlags lysing_flag  = 1 << 0;
 	static constexpr AtomFlags dropped_flag = 1 << 1;
 	static constexpr AtomFlags closed_flag  = 1 << 2;
 	static constexpr AtomFlags dupe_flag    = 1 << 3;
+	static constexpr AtomFlags content_flag = 1 << 4;
+	static constexpr AtomFlags frozen_flag  = 1 << 5;
+	static constexpr AtomFlags scripted_flag= 1 << 6;
+	static constexpr AtomFlags versioned_flag=1 << 7;
+	static constexpr AtomFlags embedded_flag= 1 << 8;
+	static constexpr AtomFlags link_flag    = 1 << 9;
+	static constexpr AtomFlags lock_writer  = 1L << 16;
+	static constexpr AtomFlags lock_waiting = 1L << 17;
+	static constexpr AtomFlags lock_reader  = 1L << 18;
+	static constexpr AtomFlags edit_unit    = 1L << 32;
+	static constexpr AtomFlags lock_readers = edit_unit - lock_reader;
+
+	/// the shared count carries its bias state in the low bits, a plain count past the limit spills into it
+	using BiasCount = int;
+	static constexpr BiasCount bias_merged = 1 << 0;
+	static constexpr BiasCount bias_queued = 1 << 1;
+	static constexpr BiasCount bias_unit   = 1 << 2;
+	static constexpr BiasCount bias_limit  = 0xffff;
+
+	extern thread_local OwnerBias* tlsBias;
+
+	/// a Lobe thread's claim on the atoms it made, their counts stay plain until they escape,
+	/// the claim is freed once its thread is gone and the last of its atoms has merged, atoms find it by slot and a thread that finds every slot taken runs unbiased
+	class OwnerBias : public NoCopy
+	{
+		friend class Atom;
+		static std::mutex  owners_lock;
+		static OwnerBias*  owner_slots[Memory::biasSlots];
+		const uint16_t     bias_slot;
+		std::mutex         merge_lock;
+		std::vector<Atom*, TAllocatorT<Atom*>>  merge_queue;
+		std::atomic_bool   merge_pending;
+		bool               owner_gone;
+		long               biased_atoms;
+		std::atomic_long   orphan_atoms;
+		explicit OwnerBias ( int bias_slot );
+		void Orphan_Merged ( void );
+		void Reclaim       ( void );
+	public:
+		bool Queue_Merge ( Atom* biased_atom );
+		static void Claim_Thread   ( void );
+		static void Vacate_Thread  ( void );
+		static void Merge_Queued   ( void );
+		static void Release_Owners ( void );
+		static int  Slot_Here      ( void ) { return tlsBias ? tlsBias->bias_slot : 0; }
+	};
 
 	/// the atom is reference counted and self-destructs (lyces iteslf)
 	class Atom : public NoCopy
 	{
-		std::atomic_long  retain_count;
+		friend class OwnerBias;
+		friend class GeneLock;
+		const uint16_t    bias_slot;
+		uint16_t          biased_count;
+		std::atomic<BiasCount> shared_count;
 		std::atomic_long  atom_flags;
+		OwnerBias* Bias_Owner ( void ) const   { return OwnerBias::owner_slots[bias_slot]; }
+		bool  Owned_Here  ( void ) const       { return bias_slot == OwnerBias::Slot_Here() && !( shared_count.load ( std::memory_order_relaxed ) & bias_merged ); }
+		bool  Unbias      ( void );
+		bool  Merge_Bias  ( void );
 	protected:
 		virtual ~Atom ( void );
-		Atom ( void ) : retain_count ( 1 ), atom_flags ( 0 ) {}
-	public:
-		void  Attach      ( void )             { ++retain_count; }
+		Atom ( void )
+		: bias_slot    ( OwnerBias::Slot_Here() )
+		, biased_count ( bias_slot ? 1 : 0 )
+		, shared_count ( bias_slot ? 0 : bias_unit | bias_merged )
+		, atom_flags   ( 0 ) { if ( bias_slot ) ++tlsBias->biased_atoms; }
+		void  Count_Edit  ( void )             {         atom_flags.fetch_add ( edit_unit ); }
+		long  Edit_Count  ( void )             { return  atom_flags.load() / edit_unit; }
+	public:
+		void  Attach      ( void )             { if ( Owned_Here() && biased_count < bias_limit ) ++biased_count; else shared_count.fetch_add ( bias_unit, std::memory_order_relaxed ); }
 		void  Release     ( void );
+		Atom* Escape      ( void );
 		void  Set_Flags   ( AtomFlags _flags)  {         atom_flags |=  _flags;       }
 		void  Clear_Flags ( AtomFlags _flags)  {         atom_flags &= ~_flags;       }
 		bool  Test_Flags  ( AtomFlags _flags)  { return (atom_flags &   _flags) != 0; }
 	};
 
+	/// intrusive handle on an Atom, a move hands the reference on without touching the count
+	template <class T>
+	class Ref
+	{
+		T*  atom;
+	public:
+		~Ref ( void )                         { if ( atom ) atom->Release(); }
+		Ref  ( void )                         : atom ( nullptr ) {}
+		explicit Ref ( T* _atom )             : atom ( _atom )     { if ( atom ) atom->Attach(); }
+		Ref  ( const Ref& _ref )              : atom ( _ref.atom ) { if ( atom ) atom->Attach(); }
+		Ref  ( Ref&& _ref ) noexcept          : atom ( _ref.Detach() ) {}
+		template <class U>
+		Ref  ( Ref<U>&& _ref ) noexcept       : atom ( _ref.Detach() ) {}
+		Ref& operator= ( Ref _ref ) noexcept  { std::swap ( atom, _ref.atom ); return *this; }
+		static Ref Adopt ( T* _atom )         { Ref ref; ref.atom = _atom; return ref; }
+		T*   Detach      ( void )             { T* held = atom; atom = nullptr; return held; }
+		T*   Get         ( void ) const       { return atom; }
+		T*   operator->  ( void ) const       { return atom; }
+		explicit operator bool ( void ) const { return atom != nullptr; }
+	};
+
 
 	/// ordered map, release the atom on extract
-	template<class Tkey, typename TAtom = Atom*>
-	class MapReleaseT : public MapT<Tkey, TAtom>
+	template<class Tkey, typename TAtom = Atom*, class TMap = MapT<Tkey, TAtom>>
+	class MapReleaseT : public TMap
 	{
 	public:
 		~MapReleaseT() {
@@ -523,9 +1249,11 @@ namespace XEPL
 
 
 	/// atoms bond together
-	class Bond : public NoCopy
+	class Bond : public NoCopy, public RecycleAsT<Bond>
 	{
 	public:
+		using RecycleAsT<Bond>::operator new;
+		using RecycleAsT<Bond>::operator delete;
 		Bond*  next_bond;
 		Bond*  prev_bond;
 		Atom*  atom;
@@ -535,27 +1263,38 @@ namespace XEPL
 		, atom ( _atom )           { if ( _atom ) _atom->Attach(); 
 		                             if ( _previous ) _previous->next_bond = this;  }
 		~Bond ( void )             { if (  atom )  atom->Release(); }
+		Atom* Unbind ( void )      { Atom* bound = atom; atom = nullptr; return bound; }
+	};
+
+	/// where a Gene sits in its Genes chain and in its same name chain
+	class GeneBonds
+	{
+	public:
+		Bond*  gene_bond;
+		Bond*  name_bond;
 	};
-	class BondMap : public UMapT<Atom*, Bond*> {};
+	class BondMap : public UMapT<Atom*, GeneBonds> {};
 
 
-	/// the head bond is a chain of atoms
-	class Chain : public NoCopy
+	/// the head bond is a chain of TAtoms, guarded by the TLock policy
+	template <class TAtom, class TLock>
+	class ChainT : public NoCopy
 	{
 	public:
-		Mutex*    chain_lock;
+		TLock     chain_lock;
 		Bond*     head_bond;
 		Bond*     tail_bond;
-		bool      is_my_lock;
-		~Chain();
-		explicit Chain      ( bool   use_protection     );
-		explicit Chain      ( Atom*  starting_with_atom );
-		Bond*  Add_Atom     ( Atom*  this_atom  );
-		bool   Pull_Atom    ( Atom** found_atom );
-		bool   Remove_Atom  ( Atom*  this_atom  );
-		void   Remove_Bond  ( Bond*  this_bond  );
+		~ChainT ( void );
+		ChainT  ( void );
+		explicit ChainT     ( TAtom*  starting_with_atom );
+		Bond*  Add_Atom     ( TAtom*  this_atom  );
+		bool   Pull_Atom    ( TAtom** found_atom );
+		bool   Remove_Atom  ( TAtom*  this_atom  );
+		bool   Remove_Bond  ( Bond*   this_bond  );
+		Bond*  Detach_Bonds ( void );
+		static TAtom* Atom_Of ( Bond* _bond )  { return static_cast<TAtom*> ( _bond->atom ); }
 	};
-	class ChainMap : public MapDeleteT<Cord, Chain*> {};
+	class ChainMap : public MapDeleteT<Cord*, ChainT<Gene, NoLock>*, SymbolMapT<ChainT<Gene, NoLock>*>> {};
 
 
 	/// Wrap the Gene that is a xml Method
@@ -582,32 +1321,69 @@ namespace XEPL
 	};
 
 
-	/// The Gene Cell is the Xepl XML database
-	class Gene : public Cell
+	/// The Lobe that owns a set of Genes, held by each of them and let go when the Lobe dies
+	class GeneOwner : public Atom
+	{
+	protected:
+		virtual ~GeneOwner ( void ) override;
+	public:
+		std::atomic<Lobe*>  owner_lobe;
+		SpinLock            owner_lock;
+		explicit GeneOwner ( Lobe* owning_lobe );
+		bool Post_Action   ( Action* mutation_action );
+		void Lobe_Died     ( void );
+	};
+
+
+	/// The Gene members few Genes use, made the first time one is needed and kept until the Gene dies
+	class GeneExtension : public NoCopy, public RecycleAsT<GeneExtension>
+	{
+	public:
+		using RecycleAsT<GeneExtension>::operator new;
+		using RecycleAsT<GeneExtension>::operator delete;
+		Cord*     space_string;
+		Gene*     lock_source;
+		String    content_string;
+		std::atomic<GeneVersion*> gene_version;
+		std::atomic<GeneOwner*>   gene_owner;
+		~GeneExtension ( void );
+		GeneExtension  ( void );
+	};
+
+
+	/// The Gene Cell is the Xepl XML database;
+	/// a Gene its frozen parent refuses is kept by the Lobe until the current Action is done;
+	/// changes from other Lobes to a Gene a Lobe owns are posted there and land later, Owner_Wait waits for them;
+	/// a change that answers (Make_One, Trait_Tap, Share_Content ...) runs on the owner while the caller waits, Make_Content is refused
+	class Gene : public Cell, public RecycleAsT<Gene>
 	{
 	protected:
 		virtual ~Gene ( void ) override;
 	public:
+		using RecycleAsT<Gene>::operator new;
+		using RecycleAsT<Gene>::operator delete;
 		Wire*     content_wire;
 		Traits*   traits;
 		Genes*    inner_genes;
-		String*   space_string;
-		Mutex*    content_mutex;
 		Gene*     owner_link;
+		std::atomic<GeneExtension*> gene_extension;
 		explicit Gene ( Text*  xml_text );
 		explicit Gene ( Gene*  parent_gene, Cord* gene_name, Cord* space_name );
 		explicit Gene ( Gene*  parent_gene, Text* gene_name, Cord* space_name);
 		explicit Gene ( Gene*  parent_gene, Cord* gene_name);
 		Cord*   Trait_Raw        ( Cord*  trait_name );
 		Cord*   Trait_Raw        ( Text*  trait_name );
+		Cord*   Trait_Raw        ( std::string_view trait_name );
 		Text*   Trait_Default    ( Text*  trait_name,  Text*   defaut_to  );
 		Cord*   Trait_Get        ( Cord*  trait_name,  String* term_value );
 		Cord*   Trait_Get        ( Text*  trait_name,  String* term_value );
+		Cord*   Trait_Get        ( std::string_view trait_name, String* term_value );
 		Cord*   Trait_Tap        ( Text*  trait_name,  Text*   term_value );
 		void    Trait_Set        ( Cord*  trait_name,  Cord*   term_value );
 		void    Trait_Set        ( Cord*  trait_name,  Text*   term_value );
 		void    Trait_Set        ( Text*  trait_name,  Cord*   term_value );
 		void    Trait_Set        ( Text*  trait_name,  Text*   term_value );
+		void    Trait_Set        ( String&& trait_name, String&& term_value );
 		String* Make_Content     ( void );
 		bool    Has_Content      ( void );
 		Gene*   First            ( void );
@@ -617,7 +1393,10 @@ namespace XEPL
 		void    Append_Content   ( Wire*       with_wire   );
 		void    Append_Content   ( Cord*       with_cord   );
 		void    Assign_Content   ( Cord*       to_cord     );
+		void    Assign_Content   ( String&&    adopt_string );
+		void    Append_Content   ( String&&    adopt_string );
 		bool    Copy_Content     ( String*     into_string );
+		Wire*   Share_Content    ( void );
 		void    Append_Content   ( Text*       content_source, long number_of_bytes);
 		Gene*   Make_One         ( Text*  gene_name );
 		Gene*   Get_First        ( Text*  gene_name );
@@ -626,6 +1405,7 @@ namespace XEPL
 		bool    Replace_Gene     ( Cord*  gene_name, Gene* replacemnt_gene   );
 		bool    Get_First_Gene   ( Cord*  gene_name, Gene** first_gene_named );
 		bool    Get_First_Gene   ( Text*  gene_name, Gene** first_gene_named );
+		bool    Get_First_Gene   ( std::string_view gene_name, Gene** first_gene_named );
 		void    Add_Gene         ( Gene*  this_gene );
 		void    Remove_Gene      ( Gene*  this_gene );
 		void    Copy_Genes_Into  ( GeneChain** copy_of_chain );
@@ -633,15 +1413,34 @@ namespace XEPL
 		void    Absorb_Gene      ( Gene*       absorb_this );
 		void    Duplicate_Gene   ( Gene**      duplicate_gene );
 		void    Print_Into       ( String*     into_string, int traversal_depth = 0 );
-	};
-
-
-	class GeneChain : public Chain
-	{
-		Gene*  current_gene;
-	public:
-		~GeneChain ( void );
-		explicit GeneChain ( const Chain* from_chain );
+		void    Freeze           ( void );
+		void    Frozen_Copy      ( Gene**      frozen_copy );
+		bool    Write_Refused    ( Text*       mutation_name );
+		void    Park_Refused     ( void );
+		void    Retire_Versions  ( void );
+		void    Orphan_Genes     ( void );
+		GeneVersion* Snapshot_Version ( bool*  version_cached, GeneVersion** private_versions );
+		void    Own              ( Lobe*       owning_lobe );
+		GeneExtension* Extension ( void );
+		Cord*   Space_String     ( void ) { GeneExtension* extension = gene_extension.load(); return extension ? extension->space_string : nullptr; }
+		Gene*   Lock_Gene        ( void ) { return Test_Flags ( dupe_flag ) ? gene_extension.load()->lock_source : this; }
+		GeneVersion* Cached_Version ( void ) { GeneExtension* extension = gene_extension.load(); return extension ? extension->gene_version.load() : nullptr; }
+		GeneOwner* Gene_Owner    ( void ) { GeneExtension* extension = gene_extension.load(); return extension ? extension->gene_owner.load() : nullptr; }
+		Lobe*   Owner_Lobe       ( void ) { GeneOwner* owner = Gene_Owner(); return owner ? owner->owner_lobe.load() : nullptr; }
+		bool    Remote_Owner     ( void ) { Lobe* lobe = Owner_Lobe(); return lobe && lobe != tlsLobe; }
+		void    Post_To_Owner    ( GeneAction* mutation_action );
+		void    Owner_Call       ( GeneAction* mutation_action );
+		void    Owner_Wait       ( void );
+		Gene*   Read_Lock        ( void ) { if ( Test_Flags ( frozen_flag ) ) return nullptr; Lobe* lobe = Owner_Lobe(); return lobe && lobe == tlsLobe ? nullptr : Lock_Gene(); }
+	};
+
+
+	class GeneChain : public ChainT<Gene, NoLock>
+	{
+		Ref<Gene>  current_gene;
+	public:
+		GeneChain ( void );
+		explicit GeneChain ( const GeneChain* from_chain );
 		bool     Next      ( Gene**       next_gene);
 	};
 
@@ -657,7 +1456,7 @@ namespace XEPL
 		explicit Genes ( Gene* );
 		void   Flush         ( void );
 		void   Add_Gene      ( Gene* adding_gene );
-		bool   Find_Gene     ( Cord* gene_name, Gene** found_gene );
+		bool   Find_Gene     ( std::string_view gene_name, Gene** found_gene );
 		void   Remove_Bond   ( Bond* gene_bond );
 		void   Print_Into    ( String* into_string, int depth_to_traverse );
 		friend class Gene;
@@ -675,6 +1474,43 @@ namespace XEPL
 	};
 
 
+	/// An immutable image of a Gene, sharing the images of unchanged inner Genes
+	class GeneVersion : public NoCopy, public RecycleAsT<GeneVersion>
+	{
+	public:
+		using RecycleAsT<GeneVersion>::operator new;
+		using RecycleAsT<GeneVersion>::operator delete;
+		using Versions = std::vector<GeneVersion*, TAllocatorT<GeneVersion*>>;
+		Cord*         cell_name;
+		Cord*         space_string;
+		Traits*       traits;
+		String        content_string;
+		bool          has_content;
+		Versions      inner_versions;
+		GeneVersion*  retired_next;
+		long          retired_epoch;
+		~GeneVersion ( void );
+		explicit GeneVersion ( Gene* image_of );
+		Cord* Trait_Raw        ( std::string_view trait_name );
+		bool  Get_First        ( std::string_view gene_name, GeneVersion** first_version );
+		void  Print_Into       ( String* into_string, int traversal_depth = 0 );
+		static void Retire     ( GeneVersion* retired_list );
+		static void Reclaim    ( void );
+	};
+
+	/// O(1) lock-free view of a Gene subtree, unchanged for as long as it lives;
+	/// versions that could not be cached on their Genes belong to the snapshot and are retired when it ends
+	class GeneSnapshot : NoAllocator
+	{
+		EpochScope    pinned_epoch;
+		GeneVersion*  private_versions;
+	public:
+		GeneVersion*  version;
+		~GeneSnapshot ( void );
+		explicit GeneSnapshot ( Gene* snapshot_of );
+	};
+
+
 	/// For walking the Gene
 	class StableGenes : NoAllocator
 	{
@@ -690,7 +1526,7 @@ namespace XEPL
 	class StableTraits : NoAllocator
 	{
 		Traits*  stable_traits;
-		Trait*   current_trait;
+		size_t   trait_index;
 	public:
 		~StableTraits ( void );
 		explicit StableTraits ( Gene* using_gene );
@@ -698,41 +1534,48 @@ namespace XEPL
 	};
 
 
-	/// Same Gene with unique Traits
+	/// Same Gene with unique Traits, or the Gene itself when frozen without scripts
 	class DuplicateTraits : NoAllocator
 	{
+		bool  shared_as_is;
 	public:
 		Gene* gene;
 		explicit DuplicateTraits ( Gene* _gene )
-		: gene ( nullptr ) { _gene->Duplicate_Gene ( &gene ); }
-		~DuplicateTraits() { gene->Release(); }
+		: shared_as_is ( _gene->Test_Flags ( frozen_flag ) && !_gene->Test_Flags ( scripted_flag ) )
+		, gene ( _gene ) { if ( !shared_as_is ) _gene->Duplicate_Gene ( &gene ); }
+		~DuplicateTraits() { if ( !shared_as_is ) gene->Release(); }
 	};
 
 
 	/// Named String pair
-	class Trait : public NoCopy
+	class Trait : public NoCopy, public RecycleAsT<Trait>
 	{
 	public:
-		Trait*  next_trait;
+		using RecycleAsT<Trait>::operator new;
+		using RecycleAsT<Trait>::operator delete;
 		Cord*   trait_name;
 		String* trait_term;
-		explicit Trait ( Cord*  trait_name,  Cord* term_value, Trait* next_trait );
-		explicit Trait ( Trait* using_trait,                   Trait* next_trait );
+		explicit Trait ( Cord*  trait_name,  Cord*    term_value );
+		explicit Trait ( Cord*  trait_name,  String&& term_value );
+		explicit Trait ( Trait* using_trait );
 		~Trait ( void );
 		void Print_Into ( String* into_string );
 	};
-	class TraitMap : public MapT<Cord, Trait*> {};
+	class TraitMap : public SymbolFlatMapT<Trait*> {};
 
-	/// A map/list of key/value pairs
+	/// A map of key/value pairs, kept in the order they were set
 	class Traits   : public NoCopy
 	{
 	public:
-		Trait*     first_trait;
-		TraitMap*  map_of_traits;
+		TraitMap   map_of_traits;
 		~Traits ( void );
 		Traits  ( void );
 		void  Set_Trait      ( Cord*    trait_name,    Cord*    term_value );
-		void  Evaluate       ( Gene*    attributes,    Nucleus* using_gene );
+		void  Set_Trait      ( Cord*    trait_name,    String&& term_value );
+		void  Evaluate       ( Gene*    scripts_for,   Nucleus* using_gene );
+		void  Absorb         ( Traits*  adopt_traits   );
+		bool  Has_Scripts    ( void );
+		void  Scripted_Into  ( Traits** copy_of_scripts );
 		void  Duplicate_Into ( Traits** copy_of_traits );
 		void  Print_Into     ( String*  into_string    );
 	};
@@ -760,6 +1603,7 @@ namespace XEPL
 		void Register_Method      ( Text*  method_name, Function cell_function, Gene* xepl_gene);
 		bool Performed_Method     ( Cord*  method_name, Gene*    on_gene );
 		bool Performed_Method     ( Text*  method_name, Gene*    on_gene );
+		bool Performed_Method     ( std::string_view method_name, Gene* on_gene );
 		void Method_Execute       ( Gene*  call_gene,   Gene* after_code );
 		void Register_Gene        ( Cord*  gene_name,   Gene* to_be );
 		void Register_Gene        ( Text*  gene_name,   Gene* to_be );
@@ -767,6 +1611,7 @@ namespace XEPL
 		void Process_Inner_Genes  ( Gene*  code_gene );
 		bool Process_Exact_Gene   ( Cord*  gene_name,   Gene* inside_gene );
 		bool Process_Exact_Gene   ( Text*  gene_name,   Gene* inside_gene );
+		bool Process_Exact_Gene   ( std::string_view gene_name, Gene* inside_gene );
 		bool Property_Get         ( Cord*  trait_name,  String* append_to );
 		bool Property_Hunt        ( Cord*  trait_name,  String* append_to );
 		void Property_Set         ( Cord*  trait_name,  Cord*   using_value );
@@ -782,19 +1627,21 @@ namespace XEPL
 		friend class Synapse;
 		friend class Receptor;
 		friend class DropAction;
+		friend class NeuronChain;
 		ReceptorChain*  receptor_chain;
 		AxonChain*      axon_chain;
 		AxonMap*        axon_map;
 		RelayMap*       relay_map;
 		NeuronMap*      neuron_map;
 		NeuronChain*    neuron_chain;
+		Bond*           neuron_bond;
 		void  Drop_My_Axons       ( void );
 		void  Drop_My_Neurons     ( void );
 		void  Drop_My_Receptors   ( void );
 		void  Register_Neuron     ( Neuron* child_neuron );
 		void  Unregister_Neuron   ( Neuron* child_neuron );
-		bool  Hunt_Neuron         ( Cord*   neuron_name, Neuron** found_neuron );
-		bool  Get_Neuron          ( Cord*   neuron_name, Neuron** found_neuron );
+		bool  Hunt_Neuron         ( std::string_view neuron_name, Neuron** found_neuron );
+		bool  Get_Neuron          ( std::string_view neuron_name, Neuron** found_neuron );
 		void  Connect_Receptor    ( Axon*   axon_name,   Receptor* to_receptor );
 		void  Disconnect_Receptor ( Receptor* from_receptor );
 		void  Disconnect_Relay    ( Relay*    from_receptor );
@@ -818,22 +1665,25 @@ namespace XEPL
 		void  Synapse_Axon      ( Axon*   target_axon,  Receiver to_receiver, Cell* memento_cell );
 		bool  Find_Neuron       ( Cord*   neuron_name,  Neuron** found_neuron );
 		bool  Find_Neuron       ( Text*   neuron_name,  Neuron** found_neuron );
+		bool  Find_Neuron       ( std::string_view neuron_name, Neuron** found_neuron );
 		bool  Drop_Neuron       ( Cord*   neuron_name );
 		bool  Drop_Neuron       ( Text*   neuron_name );
+		bool  Drop_Neuron       ( std::string_view neuron_name );
 		void  Show_Neurons      ( String* into_string );
 		void  Register_Macro    ( Cord*   macro_name,   String* macro_string );
 		bool  Performed_Macro   ( Cord*   macro_name,   Cord*   macro_string, String* seed_string, bool& truth, String* );
 		bool  Macro_Hunt        ( Cord*   macro_name,   String* macro_string );
 		bool  Feature_Get       ( Cord*   feature_name, String* feature_value );
 		bool  Feature_Get       ( Text*   feature_name, String* feature_value );
+		bool  Feature_Get       ( std::string_view feature_name, String* feature_value );
 		void  Method_Terminate  ( Gene*   unused1,      Gene* unused2 );
 	};
-	class NeuronMap : public MapReleaseT<Cord, Neuron*> {};
+	class NeuronMap : public MapReleaseT<Cord*, Neuron*, SymbolMapT<Neuron*>> {};
 
-	class NeuronChain : public Chain
+	class NeuronChain : public ChainT<Neuron, Mutex>
 	{
 		NeuronChain( );
-		Neuron* Last ( void );
+		Bond*   Detach_Neurons ( void );
 		friend class Neuron;
 	};
 
@@ -848,9 +1698,8 @@ namespace XEPL
 
 
 	/// indicies reach back into the stack of indexes
-	class Indicies : NoAllocator
+	class Indicies : public ChainT<Gene, NoLock>, NoAllocator
 	{
-		Bond*   tail_bond;
 	public:
 		Indicies();
 		void  Stack  ( Lobe* host_lobe, Gene* replacement_gene );
@@ -892,22 +1741,49 @@ namespace XEPL
 	};
 
 
-	/// List of Action to be processed by the Lobe
-	class ActionList : public NoCopy
+	/// what a poster does when the Lobe is over its budget
+	using BudgetPolicy = int;
+	static constexpr BudgetPolicy budget_block = 0;
+	static constexpr BudgetPolicy budget_fail  = 1;
+	static constexpr BudgetPolicy budget_spill = 2;
+
+	/// List of Action to be processed by the Lobe, posted by many and pulled by one;
+	/// the puller's end, the posters' end and the budget each keep to their own cache line
+	class ActionList : public NoCopy, public CacheAlignedRecycler
 	{
 		friend class Lobe;
-		Mutex*    actions_lock;
-		Action*   head_action;
-		Action*   tail_action;
-		Lobe*     lobe;
-		bool      list_is_closed;
-	public:
+		Lobe*         lobe;
+		std::atomic_bool  list_is_closed;
+		Semaphore*    budget_semaphore;
+		long          budget_bytes;
+		BudgetPolicy  budget_policy;
+		alignas ( Memory::cacheLine ) std::atomic<Action*>  head_action;
+		std::atomic_long  dequeued_bytes;
+		alignas ( Memory::cacheLine ) std::atomic<Action*>  tail_action;
+		std::atomic_long  enqueued_bytes;
+		alignas ( Memory::cacheLine ) std::atomic_long  heap_bytes;
+		std::atomic_long  budget_waiters;
+		std::atomic_long  count_blocked;
+		std::atomic_long  count_refused;
+		std::atomic_long  count_spilled;
+		long    Queued_Bytes ( void ) { return enqueued_bytes - dequeued_bytes; }
+		long    Budget_Used ( void );
+		void    Budget_Wake ( void );
+		bool    Link_Action ( Action* );
+		Action* Take_Action ( void );
+	public:
+		using CacheAlignedRecycler::operator new;
+		using CacheAlignedRecycler::operator delete;
 		~ActionList ( void );
 		explicit ActionList    ( Lobe*  host_lobe );
 		void Close_Action_List ( void );
 		void Flush_Action_list ( void );
 		bool Pull_Action       ( Action**   next_action );
 		void Post_Action       ( Action*  latest_action );
+		void Set_Budget        ( long budget_bytes, BudgetPolicy );
+		bool Admit_Post        ( void );
+		void Publish_Heap      ( long heap_bytes );
+		void Report_Budget     ( Gene* into_gene );
 	};
 
 
@@ -934,12 +1810,13 @@ namespace XEPL
 		bool  Get_Into      ( Cord*       trait_name, String* into_string );
 		void  Set           ( Cord*       trait_name, Cord*   term_value  );
 		void  Set           ( Text*       trait_name, Cord*   term_value  );
+		void  Set           ( String&&    trait_name, Cord*   term_value  );
 		static void Replace_Traits ( Gene* using_terms );
 	};
 
 
 	/// The Lobe is the Thread Neuorn foor all its Neurons
-	class Lobe : public Neuron
+	class Lobe : public Neuron, public CacheAlignedRecycler
 	{
 		virtual void Nucleus_Dropped   ( void   ) override;
 		virtual void Neuron_Drop_Relay ( Relay* ) override;
@@ -950,20 +1827,27 @@ namespace XEPL
 		virtual ~Lobe                  ( void ) override;
 		virtual void Lobe_Rest_Now     ( void );
 	public:
+		using CacheAlignedRecycler::operator new;
+		using CacheAlignedRecycler::operator delete;
 		ActionList*       pending_actions;
 		Semaphore*        rest_semaphore;
 		Thread*           cpp_thread;
+		alignas ( Memory::cacheLine )
 		Gene*             index_link;
 		Gene*             outdex_link;
 		Gene*             locals;
 		Ephemerals*       ephemerals;
 		ShortTerms*       short_terms;
+		ChainT<Gene, NoLock>*  refused_genes;
+		GeneOwner*        gene_owner;
 		Lobe*             parent_lobe;
 		Rendon*           active_rendon;
 		Atom*             trigger_atom;
 		String*           output_string;
 		Indicies          indicies;
 		Counters          counters;
+		ScratchArena      scratch_arena;
+		long              trim_decay;
 		explicit Lobe ( Text*    lobe_name );
 		explicit Lobe ( Neuron*  parent_neuron, Gene* config_gene );
 		virtual void Lobe_Dying    ( void );
@@ -995,6 +1879,8 @@ namespace XEPL
 		void   Append       ( Wire*    from_wire   );
 		void   Append       ( Cord*    from_cord   );
 		void   Assign       ( Cord*    from_cord   );
+		void   Assign       ( String&& adopt_string );
+		void   Append       ( String&& adopt_string );
 		bool   Extract_Line ( String*  into_string );
 		bool   Expire       ( size_t   number_of_bytes );
 		void   Print_Into   ( String*  into_string );
@@ -1013,14 +1899,17 @@ namespace XEPL
 
 
 	/// A signal conduit for delivering an Action to Receptor Neuron
-	class Axon : public Atom
+	class Axon : public Atom, public CacheAlignedRecycler
 	{
 	protected:
 		virtual ~Axon ( void ) override;
 	public:
+		using CacheAlignedRecycler::operator new;
+		using CacheAlignedRecycler::operator delete;
 		Cord*            axon_name;
 		Neuron*          host_neuron;
 		ReceptorChain*   receptor_chain;
+		Bond*            axon_bond;
 		explicit Axon ( Neuron*  host_neuron, Cord*  axon_name );
 		explicit Axon ( Neuron*  host_neuron, Text*  axon_name );
 		void Synapse          ( Neuron* host_neuron,  Gene* action_gene );
@@ -1028,8 +1917,8 @@ namespace XEPL
 		void Trigger_Wait     ( Atom*   signal_gene );
 		void Cancel_Receptors ( void );
 	};
-	class AxonMap : public MapReleaseT<Cord, Axon*> {};
-	class AxonChain : public Chain
+	class AxonMap : public MapReleaseT<Cord*, Axon*, SymbolMapT<Axon*>> {};
+	class AxonChain : public ChainT<Axon, Mutex>
 	{
 	public:
 		AxonChain ( void );
@@ -1038,21 +1927,25 @@ namespace XEPL
 
 
 	/// Receptors attach to an Axon and catch/deliver the Action
-	class Receptor : public Atom
+	class Receptor : public Atom, public CacheAlignedRecycler
 	{
 	protected:
 		virtual  ~Receptor ( void ) override;
 	public:
+		using CacheAlignedRecycler::operator new;
+		using CacheAlignedRecycler::operator delete;
 		Neuron*   target_neuron;
 		Axon*     signal_axon;
 		Receiver  signal_receiver;
 		Atom*     memento_atom;
+		Bond*     receptor_bond;
+		Bond*     relay_bond;
 
 		explicit Receptor ( Neuron* target_neuron, Axon* axon_name, Receiver, Atom* deliver_memento ) ;
 		virtual void Receptor_Activate ( Atom* ) const;
 		virtual void Receptor_Cancel   ( void );
 	};
-	class ReceptorChain : public Chain
+	class ReceptorChain : public ChainT<Receptor, Mutex>
 	{
 	public:
 		explicit ReceptorChain     ( void );
@@ -1086,19 +1979,21 @@ namespace XEPL
 	class Action : public NoCopy
 	{
 	public:
-		Receptor*   receptor;
-		Atom*       trigger_atom;
-		Action*     next_action;
-		explicit Action ( Receptor* deliver_to_receptor, Atom* signal_atom );
+		Ref<Receptor>  receptor;
+		Ref<Atom>      trigger_atom;
+		std::atomic<Action*>  next_action;
+		explicit Action ( Ref<Receptor>&& deliver_to_receptor, Atom* signal_atom );
 		virtual ~Action ( void );
 		virtual void Action_Execute  ( void ) = 0;
 	};
 
 	/// The Signal Action carries an Atom to be processed
-	class SignalAction : public Action
+	class SignalAction : public Action, public RecycleAsT<SignalAction>
 	{
 	public:
-		explicit     SignalAction   ( Receptor* deliver_to_receptor, Atom* signal_atom );
+		using RecycleAsT<SignalAction>::operator new;
+		using RecycleAsT<SignalAction>::operator delete;
+		explicit     SignalAction   ( Ref<Receptor>&& deliver_to_receptor, Atom* signal_atom );
 		virtual void Action_Execute ( void ) override;
 	};
 
@@ -1113,13 +2008,61 @@ namespace XEPL
 
 
 
+	/// what a GeneAction does to the Gene on its owning Lobe
+	enum GeneMutation
+	{
+		mutate_nothing,
+		mutate_trait,
+		mutate_assign,
+		mutate_append,
+		mutate_add,
+		mutate_remove,
+		mutate_absorb,
+		mutate_absorb_traits,
+		mutate_deflate,
+		mutate_make_one,
+		mutate_make_one_gene,
+		mutate_replace,
+		mutate_tap,
+		mutate_share
+	};
+
+	/// what a GeneAction run for a waiting Lobe hands back
+	struct GeneAnswer
+	{
+		Gene*  gene;
+		Cord*  cord;
+		Wire*  wire;
+		bool   made;
+	};
+
+	/// The GeneAction carries a change to a Gene over to the Lobe that owns it
+	class GeneAction : public Action, public RecycleAsT<GeneAction>
+	{
+		Ref<Gene>     target_gene;
+		Ref<Gene>     other_gene;
+		GeneMutation  mutation;
+		String        name_string;
+		String        term_string;
+		GeneAnswer*   gene_answer;
+	public:
+		using RecycleAsT<GeneAction>::operator new;
+		using RecycleAsT<GeneAction>::operator delete;
+		explicit     GeneAction     ( Gene* target_gene, GeneMutation, Gene* other_gene, Atom* completion_atom = nullptr );
+		explicit     GeneAction     ( Gene* target_gene, GeneMutation, String&& name_string, String&& term_string );
+		explicit     GeneAction     ( Gene* target_gene, GeneMutation, String&& name_string, String&& term_string, Gene* other_gene, GeneAnswer* gene_answer );
+		virtual void Action_Execute ( void ) override;
+	};
+
+
+
 	/// A Spike is an Action Atom carried along the Axon
 	class Spike : public Atom
 	{
 	protected:
 		virtual ~Spike ( void ) override;
 	public:
-		Atom*  stimulus;
+		Ref<Atom>  stimulus;
 		explicit Spike ( Atom* );
 	};
 
@@ -1377,7 +2320,7 @@ namespace XEPL
 
 
 
-	class KeywordsMap  : public MapT<Cord, Keyword>  {};
+	class KeywordsMap  : public SymbolMapT<Keyword>  {};
 	class OperatorsMap : public MapT<Cord, Operator> {};
 	class CommandsMap  : public MapT<Cord, Command > {};
 	class MutualsMap   : public MapT<Cord, Mutual>   {};
@@ -1388,8 +2331,10 @@ namespace XEPL
 	/// The Cortex is your single point of organization and uses a host Lobe as a Neuron proxy
 	class Cortex : NoAllocator, NoCopy
 	{
+		friend class     Thread;
 		MemoryCounts     memory_counts;
 		RecycleCounts    recycle_counts;
+		SizeClasses      size_classes;
 		Backpack         memory_backpack;
 		KeywordsMap*     keywords_map;
 		OperatorsMap*    operators_map;
@@ -1401,7 +2346,7 @@ namespace XEPL
 		ShortTerms       short_term_memories;
 		Counters         final_counters;
 		~Cortex ( void );
-		explicit Cortex ( Text*  cortex_name, std::ostream& output_stream );
+		explicit Cortex ( Text*  cortex_name, std::ostream& output_stream, long linear_limit = Memory::linearLimit, long pooled_limit = Memory::pooledLimit, PagePolicy page_policy = standard_pages );
 		void  Close_Cortex        ( void );
 		void  Register_Keyword    ( Text*    keyword_name,  Keyword  );
 		void  Register_Operator   ( Text*    operator_name, Operator );
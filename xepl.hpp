@@ -4,4 +4,5 @@
 
 bool XEPL::Show_Trace          = false;
 bool XEPL::Show_Memory_Counts  = false;
+bool XEPL::Show_Memory_Profile = false;
 bool XEPL::Show_Counters       = false;